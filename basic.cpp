@@ -9,17 +9,26 @@
 #include <functional>
 #include <memory>
 #include <cmath>
+#include <charconv>
+#include <system_error>
 #include <unordered_map>
+#include <sstream>
+#include <atomic>
+#include <mutex>
 #include "basic.h"
 #include "string_with_arrows.h"
+#include "thread_pool.h"
+#include "profiler.h"
+#include "tracer.h"
+#include "stats.h"
+#include "passes.h"
+#include "kernels.h"
 
 
 std::string DIGITS = "0123456789";
 std::string LETTERS = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
 std::string LETTERS_DIGITS = LETTERS + DIGITS;
-std::vector<std::string> KEYWORDS = { "VAR", "AND", "OR", "NOT", "IF", "ELIF", "ELSE", "FOR", "TO", "STEP", "WHILE", "FUN", "THEN", "END"};
-
-SymbolTable global_symbol_table = SymbolTable();
+std::vector<std::string> KEYWORDS = { "VAR", "AND", "OR", "NOT", "IF", "ELIF", "ELSE", "FOR", "PARFOR", "TO", "STEP", "WHILE", "FUN", "THEN", "END"};
 
 ////////////////////////////
 ////////// ERRORS //////////
@@ -99,10 +108,10 @@ InvalidSyntaxError::InvalidSyntaxError(Position pos_start, Position pos_end, std
 
 Position::Position(){}
 
-Position::Position(int idx, int ln, int col, std::string fn, std::string ftxt)
+Position::Position(int idx, int ln, int col, std::string fn, std::string_view ftxt)
 	: idx(idx), ln(ln), col(col), fn(fn) , ftxt(ftxt) {}
 
-Position Position::advance(char current_char) {
+Position& Position::advance(char current_char) {
 	idx += 1;
 	col += 1;
 	if (current_char == '\n') {
@@ -118,7 +127,7 @@ Position Position::copy() {
 
 bool Position::operator==(const Position& other) const {
     return idx == other.idx && ln == other.ln && col == other.col &&
-        fn == other.fn && ftxt == other.ftxt;
+        fn == other.fn && ftxt.size() == other.ftxt.size() && (ftxt.data() == other.ftxt.data() || ftxt == other.ftxt);
 }
 
 bool Position::operator!=(const Position& other) const {
@@ -209,7 +218,7 @@ std::string Token::get_class_name() const {
 ////////// LEXER ///////////
 ////////////////////////////
 
-Lexer::Lexer(std::string fn, std::string text) : fn(fn), text(text) {
+Lexer::Lexer(std::string fn, std::string_view text) : fn(fn), text(text) {
     pos = Position(-1, 0, -1, fn, text);
     current_char = '\0';
     advance();
@@ -229,7 +238,13 @@ std::pair<std::vector<Token>, Error> Lexer::make_tokens() {
         if (current_char == ' ' or current_char == '\t') {
             advance();
         }
-        if (current_char == ';' or current_char == '\n') {
+        else if (current_char == '\r') {
+            // CRLF is a single line break, a lone CR (old Mac files) is one on its own
+            Position cr_pos = pos.copy();
+            advance();
+            if (current_char != '\n') tokens.push_back(Token(TT_NEWLINE, DBL_MAX, "", cr_pos, temp));
+        }
+        else if (current_char == ';' or current_char == '\n') {
             tokens.push_back(Token(TT_NEWLINE, DBL_MAX, "", pos, temp));
             advance();
         }
@@ -310,7 +325,6 @@ std::pair<std::vector<Token>, Error> Lexer::make_tokens() {
 
 
 Token Lexer::make_number() {
-    std::string num_str = "";
     int dot_count = 0;
     Position pos_start = pos.copy();
 
@@ -318,17 +332,19 @@ Token Lexer::make_number() {
         if (current_char == '.') {
             if (dot_count == 1) break;
             dot_count += 1;
-            num_str += '.';
         }
-        else num_str += current_char;
         advance();
     }
 
+    // The digits are parsed in place, straight out of the source text
+    double value = 0;
+    std::from_chars(text.data() + pos_start.idx, text.data() + pos.idx, value);
+
     if (dot_count == 0) {
-        return Token(TT_INT, stoi(num_str), "", pos_start, pos);
+        return Token(TT_INT, value, "", pos_start, pos);
     }
     else {
-        return Token(TT_FLOAT, stof(num_str), "", pos_start, pos);
+        return Token(TT_FLOAT, value, "", pos_start, pos);
     }
 }
 
@@ -597,9 +613,26 @@ std::ostream& operator<<(std::ostream& os, const VarAssignNode& obj) {
 
 BinOpNode::BinOpNode(){};
 
+static Opcode opcode_for(Token op_tok) {
+    if (op_tok.type_ == TT_PLUS) return Opcode::Add;
+    if (op_tok.type_ == TT_MINUS) return Opcode::Sub;
+    if (op_tok.type_ == TT_MUL) return Opcode::Mul;
+    if (op_tok.type_ == TT_DIV) return Opcode::Div;
+    if (op_tok.type_ == TT_POW) return Opcode::Pow;
+    if (op_tok.type_ == TT_EE) return Opcode::Eq;
+    if (op_tok.type_ == TT_NE) return Opcode::Ne;
+    if (op_tok.type_ == TT_LT) return Opcode::Lt;
+    if (op_tok.type_ == TT_GT) return Opcode::Gt;
+    if (op_tok.type_ == TT_LTE) return Opcode::Lte;
+    if (op_tok.type_ == TT_GTE) return Opcode::Gte;
+    if (op_tok.matches(TT_KEYWORD, "AND")) return Opcode::And;
+    if (op_tok.matches(TT_KEYWORD, "OR")) return Opcode::Or;
+    return Opcode::count;
+}
+
 ////////////////////////////
 BinOpNode::BinOpNode(std::shared_ptr<Node> left_node, Token op_tok, std::shared_ptr<Node> right_node)
-    : left_node(left_node), op_tok(op_tok), right_node(right_node) {
+    : left_node(left_node), op_tok(op_tok), right_node(right_node), opcode(opcode_for(op_tok)) {
     if (left_node->get_class_name() == "NumberNode") {
 		pos_start = std::dynamic_pointer_cast<NumberNode>(left_node)->pos_start;
 	}
@@ -630,6 +663,12 @@ BinOpNode::BinOpNode(std::shared_ptr<Node> left_node, Token op_tok, std::shared_
     else if (left_node->get_class_name() == "CallNode") {
 		pos_start = std::dynamic_pointer_cast<CallNode>(left_node)->pos_start;
 	}
+    else if (left_node->get_class_name() == "StringNode") {
+        pos_start = std::dynamic_pointer_cast<StringNode>(left_node)->pos_start;
+    }
+    else if (left_node->get_class_name() == "ListNode") {
+        pos_start = std::dynamic_pointer_cast<ListNode>(left_node)->pos_start;
+    }
 
     if (right_node->get_class_name() == "NumberNode") {
         pos_end = std::dynamic_pointer_cast<NumberNode>(right_node)->pos_end;
@@ -661,6 +700,12 @@ BinOpNode::BinOpNode(std::shared_ptr<Node> left_node, Token op_tok, std::shared_
 	else if (right_node->get_class_name() == "CallNode") {
         pos_end = std::dynamic_pointer_cast<CallNode>(right_node)->pos_end;
 	}
+    else if (right_node->get_class_name() == "StringNode") {
+        pos_end = std::dynamic_pointer_cast<StringNode>(right_node)->pos_end;
+    }
+    else if (right_node->get_class_name() == "ListNode") {
+        pos_end = std::dynamic_pointer_cast<ListNode>(right_node)->pos_end;
+    }
 }
 
 void BinOpNode::print(std::ostream& os) const {
@@ -824,8 +869,8 @@ std::ostream& operator<<(std::ostream& os, const IfNode& obj) {
 }
 
 ////////////////////////////
-ForNode::ForNode(Token var_name_tok, std::shared_ptr<Node> start_value_node, std::shared_ptr<Node> end_value_node, std::shared_ptr<Node> step_value_node, std::shared_ptr<Node> body_node)
-    : var_name_tok(var_name_tok), start_value_node(start_value_node), end_value_node(end_value_node), step_value_node(step_value_node), body_node(body_node) {
+ForNode::ForNode(Token var_name_tok, std::shared_ptr<Node> start_value_node, std::shared_ptr<Node> end_value_node, std::shared_ptr<Node> step_value_node, std::shared_ptr<Node> body_node, bool is_parallel)
+    : var_name_tok(var_name_tok), start_value_node(start_value_node), end_value_node(end_value_node), step_value_node(step_value_node), body_node(body_node), is_parallel(is_parallel) {
     pos_start = var_name_tok.pos_start;
 
     if (body_node->get_class_name() == "NumberNode") {
@@ -861,7 +906,7 @@ ForNode::ForNode(Token var_name_tok, std::shared_ptr<Node> start_value_node, std
 }
 
 void ForNode::print(std::ostream& os) const {
-	os << "ForNode(" << var_name_tok.print() << "," << *start_value_node << "," << *end_value_node;
+	os << (is_parallel ? "ParForNode(" : "ForNode(") << var_name_tok.print() << "," << *start_value_node << "," << *end_value_node;
     if (step_value_node != nullptr) os << "," << *step_value_node;
     os << "," << *body_node << ")";
 }
@@ -1119,6 +1164,12 @@ CallNode::CallNode(std::shared_ptr<Node> node_to_call, std::vector<std::shared_p
         else if (temp->get_class_name() == "CallNode") {
             pos_end = std::dynamic_pointer_cast<CallNode>(temp)->pos_end;
         }
+        else if (temp->get_class_name() == "StringNode") {
+            pos_end = std::dynamic_pointer_cast<StringNode>(temp)->pos_end;
+        }
+        else if (temp->get_class_name() == "ListNode") {
+            pos_end = std::dynamic_pointer_cast<ListNode>(temp)->pos_end;
+        }
     }
     else {
         if (node_to_call->get_class_name() == "NumberNode") {
@@ -1175,6 +1226,18 @@ std::ostream& operator<<(std::ostream& os, const CallNode& obj) {
 	return os;
 }       
 
+////////////////////////////
+CachedNode::CachedNode(std::shared_ptr<Node> expr_node, std::string slot_name, Mode mode, Position pos_start, Position pos_end)
+    : expr_node(expr_node), slot_name(slot_name), mode(mode), pos_start(pos_start), pos_end(pos_end) {}
+
+void CachedNode::print(std::ostream& os) const {
+    os << "CachedNode(" << slot_name << ", " << *expr_node << ")";
+}
+
+std::string CachedNode::get_class_name() const {
+    return "CachedNode";
+}
+
 ////////////////////////////
 /////// PARSE RESULT ///////
 ////////////////////////////
@@ -1254,6 +1317,42 @@ RTResult RTResult::failure(Error error) {
 ////////// PARSER //////////
 ////////////////////////////
 
+// How deeply a program may nest, so that the C++ stack the parser, the
+// passes, the recursive interpreter and the AST's destructors use stays
+// bounded whatever the program, --stackless or not. A program past either
+// limit fails to parse with an InvalidSyntaxError.
+// max_nesting counts the calls of Parser::expr and factor in progress,
+// which take most of the parser's stack: two for every pair of parentheses,
+// call, list or block, one for every unary operator, NOT and ^. max_depth
+// bounds the depth of the AST, in which a chain such as a + b + c is one
+// level deeper for every operator.
+const int max_nesting = 200;
+const int max_depth = 1000;
+
+// Levels a parser rule has added to counter, taken off again when it returns
+class NestingScope
+{
+public:
+    NestingScope(int& counter, int limit)
+        : counter(counter), limit(limit) {}
+    ~NestingScope() { counter -= levels; }
+
+    NestingScope(const NestingScope&) = delete;
+    NestingScope& operator=(const NestingScope&) = delete;
+
+    // False once counter is past the limit
+    bool enter() {
+        levels++;
+        counter++;
+        return counter <= limit;
+    }
+
+private:
+    int& counter;
+    int limit;
+    int levels = 0;
+};
+
 Parser::Parser(){}
 
 Parser::Parser(std::vector<Token> tokens)
@@ -1289,6 +1388,10 @@ std::shared_ptr<Node> Parser::parse() {
     std::shared_ptr<Node> res = statements();
     std::cout << "Parse error result: " << std::dynamic_pointer_cast<ParseResult>(res)->error.is_error() << std::endl;
 
+    if (nesting_error.is_error() != "None") {
+        return std::make_shared<ParseResult>(ParseResult().failure(nesting_error));
+    }
+
     if (std::dynamic_pointer_cast<ParseResult>(res)->error.is_error() == "None" and current_tok.type_ != TT_EOF) {
         std::cout<< "Parse error result: " << std::dynamic_pointer_cast<ParseResult>(res)->error.is_error() << ", current_tok: "<<current_tok.type_<<std::endl;
         std::cout<< "Pos_start: " << current_tok.pos_start.ln << ", " << current_tok.pos_start.col << std::endl;
@@ -1333,7 +1436,9 @@ std::shared_ptr<Node> Parser::statements() {
         statements.push_back(statement);
     }
 
-    return std::make_shared<ParseResult>(res.success(std::make_shared<ListNode>(ListNode(statements, pos_start, current_tok.pos_end.copy()))));
+    ListNode block = ListNode(statements, pos_start, current_tok.pos_end.copy());
+    block.is_block = true;
+    return std::make_shared<ParseResult>(res.success(std::make_shared<ListNode>(block)));
 }
 
 std::shared_ptr<Node> Parser::list_expr() {
@@ -1353,7 +1458,7 @@ std::shared_ptr<Node> Parser::list_expr() {
     }
     else {
         element_nodes.push_back(res.register_result(expr()));
-        if (res.error.is_error() != "None") return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(current_tok.pos_start, current_tok.pos_end, "Expected ']', 'VAR', 'IF', 'FOR', 'WHILE', 'FUN', int, float, identifier, '+', '-', '(', '[' or 'NOT'")));
+        if (res.error.is_error() != "None") return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(current_tok.pos_start, current_tok.pos_end, "Expected ']', 'VAR', 'IF', 'FOR', 'PARFOR', 'WHILE', 'FUN', int, float, identifier, '+', '-', '(', '[' or 'NOT'")));
 
         while (current_tok.type_ == TT_COMMA) {
             res.register_advancement(); advance();
@@ -1567,10 +1672,11 @@ std::shared_ptr<Node> Parser::for_expr() {
     std::cout << "Pk-entering for_expr\n";
 	ParseResult res = ParseResult();	
 
-	if (!current_tok.matches(TT_KEYWORD, "FOR")) {
-		return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(current_tok.pos_start, current_tok.pos_end, "Expected 'FOR'")));
+	if (!current_tok.matches(TT_KEYWORD, "FOR") && !current_tok.matches(TT_KEYWORD, "PARFOR")) {
+		return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(current_tok.pos_start, current_tok.pos_end, "Expected 'FOR' or 'PARFOR'")));
 	}
 
+	bool is_parallel = current_tok.matches(TT_KEYWORD, "PARFOR");
 	res.register_advancement(); advance();
 
 	if (current_tok.type_ != TT_IDENTIFIER) {
@@ -1614,7 +1720,7 @@ std::shared_ptr<Node> Parser::for_expr() {
 	std::shared_ptr<Node> body = res.register_result(expr());
 	if (res.error.is_error() != "None") return std::make_shared<ParseResult>(res);
 
-	return std::make_shared<ParseResult>(res.success(std::make_shared<ForNode>(ForNode(var_name_tok, start_value, end_value, step_value, body))));
+	return std::make_shared<ParseResult>(res.success(std::make_shared<ForNode>(ForNode(var_name_tok, start_value, end_value, step_value, body, is_parallel))));
 }
 
 std::shared_ptr<Node> Parser::while_expr() {
@@ -1725,7 +1831,7 @@ std::shared_ptr<Node> Parser::call() {
 		}
 		else {
 			arg_nodes.push_back(res.register_result(expr()));
-			if (res.error.is_error() != "None") return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(current_tok.pos_start, current_tok.pos_end, "Expected ')', 'VAR', 'IF', 'FOR', 'WHILE', 'FUN', int, float, identifier, '+', '-', '(', '[' or 'NOT'")));
+			if (res.error.is_error() != "None") return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(current_tok.pos_start, current_tok.pos_end, "Expected ')', 'VAR', 'IF', 'FOR', 'PARFOR', 'WHILE', 'FUN', int, float, identifier, '+', '-', '(', '[' or 'NOT'")));
 
 			while (current_tok.type_ == TT_COMMA) {
 				res.register_advancement(); advance();
@@ -1793,7 +1899,7 @@ std::shared_ptr<Node> Parser::atom() {
         return std::make_shared<ParseResult>(res.success(if_expr_result));
     }
 
-    else if (tok.matches(TT_KEYWORD, "FOR")) {
+    else if (tok.matches(TT_KEYWORD, "FOR") || tok.matches(TT_KEYWORD, "PARFOR")) {
         std::shared_ptr<Node> for_expr_result = res.register_result(for_expr());
         if (res.error.is_error() != "None") return std::make_shared<ParseResult>(res);
         return std::make_shared<ParseResult>(res.success(for_expr_result));
@@ -1811,7 +1917,7 @@ std::shared_ptr<Node> Parser::atom() {
         return std::make_shared<ParseResult>(res.success(func_def_result));
     }
 
-    return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(tok.pos_start, tok.pos_end, "Expected int, float, identifier, '+', '-', '(', '[', 'IF', 'FOR', 'WHILE' or 'FUN'")));
+    return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(tok.pos_start, tok.pos_end, "Expected int, float, identifier, '+', '-', '(', '[', 'IF', 'FOR', 'PARFOR', 'WHILE' or 'FUN'")));
 }
 
 std::shared_ptr<Node> Parser::power() {
@@ -1826,6 +1932,9 @@ std::shared_ptr<Node> Parser::factor() {
 
     std::cout << "Entered factor..."<<tok.type_<<std::endl;
 
+    NestingScope nested(nesting, max_nesting), deeper(depth, max_depth);
+    if (!nested.enter() || !deeper.enter()) return nested_too_deeply();
+
     if (tok.type_ == TT_PLUS || tok.type_ == TT_MINUS) {
 		res.register_advancement(); advance();
 		std::shared_ptr<Node> factor_result = res.register_result(factor());
@@ -1852,7 +1961,9 @@ std::shared_ptr<Node> Parser::arith_expr() {
 std::shared_ptr<Node> Parser::comp_expr() {
 	std::cout << "Pk-entering comp_expr\n";
 	ParseResult res = ParseResult();
+    NestingScope nested(nesting, max_nesting), deeper(depth, max_depth);
     if (current_tok.matches(TT_KEYWORD, "NOT")) {
+        if (!nested.enter() || !deeper.enter()) return nested_too_deeply();
 		Token op_tok = current_tok;
 		res.register_advancement(); advance();
 		std::shared_ptr<Node> node = res.register_result(comp_expr());
@@ -1869,6 +1980,8 @@ std::shared_ptr<Node> Parser::comp_expr() {
 std::shared_ptr<Node> Parser::expr() {
     std::cout << "Pk-entering expr\n";
     ParseResult res = ParseResult();
+    NestingScope nested(nesting, max_nesting), deeper(depth, max_depth);
+    if (!nested.enter() || !deeper.enter()) return nested_too_deeply();
     if (current_tok.matches(TT_KEYWORD, "VAR")) {
         std::cout << "Variable assignment detected\n";
         res.register_advancement(); advance();
@@ -1891,7 +2004,7 @@ std::shared_ptr<Node> Parser::expr() {
     
 
     if (res.error.is_error() != "None") {
-        return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(current_tok.pos_start, current_tok.pos_end, "Expected 'VAR', 'IF', 'FOR', 'WHILE', 'FUN', int, float, identifier, '+', '-', '(', '[' or 'NOT'")));
+        return std::make_shared<ParseResult>(res.failure(InvalidSyntaxError(current_tok.pos_start, current_tok.pos_end, "Expected 'VAR', 'IF', 'FOR', 'PARFOR', 'WHILE', 'FUN', int, float, identifier, '+', '-', '(', '[' or 'NOT'")));
     }
     return std::make_shared<ParseResult>(res.success(node));
 }
@@ -1911,7 +2024,9 @@ std::shared_ptr<Node> Parser::bin_op(std::function<std::shared_ptr<Node>()> func
         return std::make_shared<ParseResult>(res);
     }
 
+    NestingScope deeper(depth, max_depth);
     while ((find(ops.begin(), ops.end(), current_tok.type_) != ops.end()) || (find(ops.begin(), ops.end(), current_tok.text) != ops.end())) {
+        if (!deeper.enter()) return nested_too_deeply();
         Token op_tok = current_tok;
         res.register_advancement(); advance();
         std::shared_ptr<Node> right = res.register_result(func_b());
@@ -1923,16 +2038,40 @@ std::shared_ptr<Node> Parser::bin_op(std::function<std::shared_ptr<Node>()> func
     return std::make_shared<ParseResult>(res.success(left));
 }
 
+std::shared_ptr<Node> Parser::nested_too_deeply() {
+    if (nesting_error.is_error() == "None") {
+        nesting_error = InvalidSyntaxError(current_tok.pos_start, current_tok.pos_end, "Expression nested too deeply");
+    }
+    return std::make_shared<ParseResult>(ParseResult().failure(nesting_error));
+}
+
 
 
 ////////////////////////////
 ///////// VALUES ///////////
 ////////////////////////////
 
+std::string_view format_number(double value, char (&buffer)[32]) {
+    // Shortest form would turn round integers such as 100000 into 1e+05, so
+    // integral values print as integers; -0 keeps its sign below
+    char* end;
+    if (value == std::trunc(value) && std::fabs(value) < 9.2e18 && !(value == 0 && std::signbit(value))) {
+        end = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<int64_t>(value)).ptr;
+    }
+    else end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+    return std::string_view(buffer, end - buffer);
+}
+
+void append_number(std::string& out, double value) {
+    char buffer[32];
+    out += format_number(value, buffer);
+}
+
 Number::Number() {}
 
 Number::Number(double value, bool is_none) 
     : value(value), is_none(is_none) {
+    ExecutionStats::record_value(ExecutionStats::ValueKind::Number);
     set_pos();
     set_context();
 }
@@ -2057,12 +2196,14 @@ bool Number::is_true() {
 }
 
 std::ostream& operator<<(std::ostream& os, const Number& obj) {
-	os << obj.value;
+    char buffer[32];
+    std::string_view text = format_number(obj.value, buffer);
+    os.write(text.data(), text.size());
 	return os;
 }
 
 void Number::print(std::ostream& os) const {
-	os << value;
+    os << *this;
 }
 
 std::string Number::get_class_name() const {
@@ -2071,6 +2212,7 @@ std::string Number::get_class_name() const {
 
 String::String(std::string value)
     : value(value) {
+    ExecutionStats::record_value(ExecutionStats::ValueKind::String);
     set_pos();
     set_context();
 }
@@ -2130,6 +2272,7 @@ List::List() {}
 
 List::List(std::vector<std::shared_ptr<Node>> elements)
     : elements(elements) {
+    ExecutionStats::record_value(ExecutionStats::ValueKind::List);
     set_pos();
     set_context();
 }
@@ -2142,6 +2285,8 @@ List List::set_pos(Position pos_start, Position pos_end) {
 
 List List::set_context(Context* context) {
     this->context = context;
+    // Errors about the list's elements are reported in context
+    if (context != nullptr) context->capture();
     return *this;
 }
 
@@ -2197,7 +2342,7 @@ std::ostream& operator<<(std::ostream& os, const List& obj) {
     os << "[";
     for (auto x : obj.elements) {
         if (x->get_class_name() == "Number") {
-            os << std::to_string(std::dynamic_pointer_cast<Number>(x)->value);
+            os << *std::dynamic_pointer_cast<Number>(x);
         }
         else if (x->get_class_name() == "String") {
             os << std::dynamic_pointer_cast<String>(x)->value;
@@ -2215,7 +2360,7 @@ void List::print(std::ostream& os) const {
     os << "[";
     for (auto x : elements) {
         if (x->get_class_name() == "Number") {
-            os<<std::to_string(std::dynamic_pointer_cast<Number>(x)->value);
+            os << *std::dynamic_pointer_cast<Number>(x);
         }
         else if (x->get_class_name() == "String") {
             os<< std::dynamic_pointer_cast<String>(x)->value;
@@ -2232,6 +2377,129 @@ std::string List::get_class_name() const {
     return "List";
 }
 
+// condition_variable::wait with a deadline from InterpreterInstance::wait_deadline.
+// Returns false if the deadline passed before ready() held.
+template <typename Predicate>
+static bool wait_until_deadline(std::condition_variable& condition, std::unique_lock<std::mutex>& lock, std::chrono::steady_clock::time_point deadline, Predicate ready) {
+    if (deadline == std::chrono::steady_clock::time_point::max()) {
+        condition.wait(lock, ready);
+        return true;
+    }
+    return condition.wait_until(lock, deadline, ready);
+}
+
+Future::Future()
+    : state(std::make_shared<State>()) {
+    set_pos();
+    set_context();
+}
+
+Future Future::set_pos(Position pos_start, Position pos_end) {
+    this->pos_start = pos_start;
+    this->pos_end = pos_end;
+    return *this;
+}
+
+Future Future::set_context(Context* context) {
+    this->context = context;
+    return *this;
+}
+
+void Future::resolve(std::shared_ptr<Node> value, Error error) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->value = value;
+    state->error = error;
+    state->done = true;
+    state->finished.notify_all();
+}
+
+bool Future::wait(std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    if (!state->done) {
+        shared_thread_pool().prepare_to_block();
+        wait_until_deadline(state->finished, lock, deadline, [this] { return state->done; });
+        shared_thread_pool().finish_blocking();
+    }
+    return state->done;
+}
+
+void Future::print(std::ostream& os) const {
+    os << "<future>";
+}
+
+std::string Future::get_class_name() const {
+    return "Future";
+}
+
+Channel::Channel(size_t capacity)
+    : state(std::make_shared<State>()) {
+    state->capacity = capacity;
+    set_pos();
+    set_context();
+}
+
+Channel Channel::set_pos(Position pos_start, Position pos_end) {
+    this->pos_start = pos_start;
+    this->pos_end = pos_end;
+    return *this;
+}
+
+Channel Channel::set_context(Context* context) {
+    this->context = context;
+    return *this;
+}
+
+// Waits while the channel is full, at most until the deadline. Closed if it
+// is closed.
+Channel::Result Channel::send(std::shared_ptr<Node> value, std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    bool room = true;
+    if (!state->closed && state->items.size() >= state->capacity) {
+        shared_thread_pool().prepare_to_block();
+        room = wait_until_deadline(state->changed, lock, deadline, [this] { return state->closed || state->items.size() < state->capacity; });
+        shared_thread_pool().finish_blocking();
+    }
+    if (state->closed) return Result::Closed;
+    if (!room) return Result::TimedOut;
+
+    state->items.push_back(value);
+    state->changed.notify_all();
+    return Result::Done;
+}
+
+// Waits while the channel is empty, at most until the deadline. Closed once
+// it is closed and drained.
+Channel::Result Channel::receive(std::chrono::steady_clock::time_point deadline, std::shared_ptr<Node>& value) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    bool ready = true;
+    if (!state->closed && state->items.empty()) {
+        shared_thread_pool().prepare_to_block();
+        ready = wait_until_deadline(state->changed, lock, deadline, [this] { return state->closed || !state->items.empty(); });
+        shared_thread_pool().finish_blocking();
+    }
+    if (!ready) return Result::TimedOut;
+    if (state->items.empty()) return Result::Closed;
+
+    value = state->items.front();
+    state->items.pop_front();
+    state->changed.notify_all();
+    return Result::Done;
+}
+
+void Channel::close() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->closed = true;
+    state->changed.notify_all();
+}
+
+void Channel::print(std::ostream& os) const {
+    os << "<channel>";
+}
+
+std::string Channel::get_class_name() const {
+    return "Channel";
+}
+
 BaseFunction::BaseFunction() {}
 
 BaseFunction::BaseFunction(std::string name) {
@@ -2253,10 +2521,7 @@ BaseFunction BaseFunction::set_context(Context* context) {
 }
 
 Context* BaseFunction::generate_new_context() {
-    Context* new_context = new Context(name, context, pos_start);
-    if (new_context->parent != nullptr) new_context->symbol_table = new SymbolTable(new_context->parent->symbol_table);
-    else new_context->symbol_table = new SymbolTable();
-    return new_context;
+    return context->instance->new_context(name, context, pos_start);
 }
 
 RTResult BaseFunction::check_args(std::vector<std::string> arg_names, std::vector<std::shared_ptr<Node>> args) {
@@ -2275,16 +2540,26 @@ RTResult BaseFunction::check_args(std::vector<std::string> arg_names, std::vecto
     return res.success(std::make_shared<Number>(Number(0,1)));
 }
 
+// A function value looks names up through the frame it was read in. Once the
+// value is stored, passed or returned it can be called after that frame's
+// call has returned, so the frame has to stay.
+static void keep_frame_of(const std::shared_ptr<Node>& value) {
+    Function* function = dynamic_cast<Function*>(value.get());
+    if (function != nullptr && function->context != nullptr) function->context->capture();
+}
+
 void BaseFunction::populate_args(std::vector<std::string> arg_names, std::vector<std::shared_ptr<Node>> args, Context* exec_ctx) {
     for (int i = 0; i < args.size(); i++) {
         std::string arg_name = arg_names[i];
         std::shared_ptr<Node> arg_value = args[i];
+        // Arguments can be list elements other threads read at the same time,
+        // so numbers and strings move into the frame as copies. Lists are
+        // passed by reference and keep the context they were made in.
         if (arg_value->get_class_name() == "Number") 
-            std::dynamic_pointer_cast<Number>(arg_value)->set_context(exec_ctx);
+            arg_value = std::make_shared<Number>(Number(*std::dynamic_pointer_cast<Number>(arg_value)).set_context(exec_ctx));
         else if (arg_value->get_class_name() == "String") 
-            std::dynamic_pointer_cast<String>(arg_value)->set_context(exec_ctx);
-        else if (arg_value->get_class_name() == "List") 
-            std::dynamic_pointer_cast<List>(arg_value)->set_context(exec_ctx);
+            arg_value = std::make_shared<String>(String(*std::dynamic_pointer_cast<String>(arg_value)).set_context(exec_ctx));
+        else keep_frame_of(arg_value);
         exec_ctx->symbol_table->set(arg_name, arg_value);
     }
 }
@@ -2312,20 +2587,68 @@ std::string BaseFunction::get_class_name() const {
     return "BaseFunction";
 }
 
+// Runs node the way the instance evaluates, with Evaluator if it is stackless
+static RTResult evaluate(std::shared_ptr<Node> node, Context* context) {
+    if (context->instance->stackless) return Evaluator(node, context).run();
+    return Interpreter().visit(node, context);
+}
+
 Function::Function(std::string name, std::shared_ptr<Node> body_node, std::vector<std::string> arg_names)
     : BaseFunction(name), body_node(body_node), arg_names(arg_names) {}
 
+// Tail calls the body returns are made here, one after the other, instead of
+// from inside the body
 RTResult Function::execute_result(std::vector<std::shared_ptr<Node>> args) {
     RTResult res = RTResult();
-    Interpreter interpreter = Interpreter();
     Context* exec_ctx = generate_new_context();
-    
-    res.register_result(check_and_populate_args(arg_names, args, exec_ctx));
-    if (res.error.is_error() != "None") return res;
+    Function* function = this;
+    std::shared_ptr<TailCall> tail_call; // owns function after the first tail call
 
-    std::shared_ptr<Node> value = res.register_result(interpreter.visit(body_node, exec_ctx));
-	if (res.error.is_error() != "None") return res;
-	return res.success(value);
+    while (true) {
+        std::shared_ptr<TailCall> next_call;
+        {
+            TraceScope trace_scope(function->name, function->pos_start);
+
+            res.register_result(function->enter_frame(args, exec_ctx));
+            if (res.error.is_error() != "None") return res;
+
+            std::shared_ptr<Node> value = res.register_result(evaluate(function->body_node, exec_ctx));
+            if (res.error.is_error() != "None") return res;
+
+            next_call = std::dynamic_pointer_cast<TailCall>(value);
+            if (next_call == nullptr) {
+                keep_frame_of(value);
+                exec_ctx->instance->release_context(exec_ctx);
+                return res.success(value);
+            }
+        }
+
+        exec_ctx = function->frame_for_tail_call(next_call->function.get(), exec_ctx);
+        args = next_call->args;
+        tail_call = next_call;
+        function = tail_call->function.get();
+    }
+}
+
+RTResult Function::enter_frame(std::vector<std::shared_ptr<Node>> args, Context* exec_ctx) {
+    Error limit_error = exec_ctx->instance->check_limits(pos_start, pos_end, exec_ctx);
+    if (limit_error.is_error() != "None") return RTResult().failure(limit_error);
+    return check_and_populate_args(arg_names, args, exec_ctx);
+}
+
+// The callee takes over the frame it is called from when the frame it would
+// get looks up names the same way: a sibling of it, or, since a function read
+// from a variable runs in the reader's context, a child of it running the
+// same body. The body binds only its parameters (mark_tail_calls), which the
+// callee binds again, so nothing in the frame stays visible to it. Any other
+// callee gets a frame of its own, and so does every call from a captured
+// frame: a task the body SPAWNed may still be looking names up through it.
+Context* Function::frame_for_tail_call(Function* callee, Context* exec_ctx) {
+    bool same_lookups = callee->context == context || (callee->context == exec_ctx && callee->body_node == body_node);
+    if (!same_lookups || exec_ctx->captured.load(std::memory_order_relaxed)) return callee->generate_new_context();
+    exec_ctx->symbol_table->clear();
+    exec_ctx->display_name = callee->name;
+    return exec_ctx;
 }
 
 Function Function::copy() {
@@ -2348,6 +2671,17 @@ std::string Function::get_class_name() const {
 	return "Function";
 }
 
+TailCall::TailCall(std::shared_ptr<Function> function, std::vector<std::shared_ptr<Node>> args)
+    : function(function), args(args) {}
+
+void TailCall::print(std::ostream& os) const {
+    os << "<tail call " << function->name << ">";
+}
+
+std::string TailCall::get_class_name() const {
+    return "TailCall";
+}
+
 BuiltInFunction::BuiltInFunction(std::string name)
     : BaseFunction(name) {}
 
@@ -2358,9 +2692,22 @@ BuiltInFunction BuiltInFunction::copy() {
     return copy;
 }
 
+// Builtins that neither keep their arguments nor run code after they return
+static bool keeps_nothing(const std::string& name) {
+    static const std::vector<std::string> names = {
+        "print", "print_ret", "input", "input_int", "clear", "flush",
+        "is_number", "is_string", "is_list", "is_function", "pop", "stats"
+    };
+    return std::find(names.begin(), names.end(), name) != names.end();
+}
+
 RTResult BuiltInFunction::execute_result(std::vector<std::shared_ptr<Node>> args) {
     RTResult res = RTResult();
     Context* exec_ctx = generate_new_context();
+    if (!keeps_nothing(name)) exec_ctx->capture();
+
+    Error limit_error = exec_ctx->instance->check_limits(pos_start, pos_end, exec_ctx);
+    if (limit_error.is_error() != "None") return res.failure(limit_error);
 
     std::string method_name = "execute_" + name;
     std::shared_ptr<Node> return_value;
@@ -2402,6 +2749,13 @@ RTResult BuiltInFunction::execute_result(std::vector<std::shared_ptr<Node>> args
         return_value = res.register_result(execute_clear(exec_ctx));
         if (res.error.is_error() != "None") return res;
     }
+    else if (method_name == "execute_flush") {
+        res.register_result(check_and_populate_args(execute_flush_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_flush(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
     else if (method_name == "execute_is_number") {
         res.register_result(check_and_populate_args(execute_is_number_arg_names_, args, exec_ctx));
         if (res.error.is_error() != "None") return res;
@@ -2451,19 +2805,104 @@ RTResult BuiltInFunction::execute_result(std::vector<std::shared_ptr<Node>> args
         return_value = res.register_result(execute_extend(exec_ctx));
         if (res.error.is_error() != "None") return res;
     }
+    else if (method_name == "execute_parallel_map") {
+        res.register_result(check_and_populate_args(execute_parallel_map_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_parallel_map(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
+    else if (method_name == "execute_spawn") {
+        // SPAWN passes everything after the function on to it
+        if (args.empty()) return res.failure(RTError(pos_start, pos_end, "1 too few arguments passed into " + name, context));
+        std::vector<std::shared_ptr<Node>> call_args(args.begin() + 1, args.end());
+
+        res.register_result(check_and_populate_args(execute_spawn_arg_names_, { args[0] }, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_spawn(exec_ctx, call_args));
+        if (res.error.is_error() != "None") return res;
+    }
+    else if (method_name == "execute_await") {
+        res.register_result(check_and_populate_args(execute_await_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_await(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
+    else if (method_name == "execute_channel") {
+        res.register_result(check_and_populate_args(execute_channel_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_channel(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
+    else if (method_name == "execute_send") {
+        res.register_result(check_and_populate_args(execute_send_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_send(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
+    else if (method_name == "execute_recv") {
+        res.register_result(check_and_populate_args(execute_recv_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_recv(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
+    else if (method_name == "execute_close") {
+        res.register_result(check_and_populate_args(execute_close_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_close(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
+    else if (method_name == "execute_stats") {
+        res.register_result(check_and_populate_args(execute_stats_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_stats(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
+    else if (method_name == "execute_parallel_reduce") {
+        res.register_result(check_and_populate_args(execute_parallel_reduce_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_parallel_reduce(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
+    else if (method_name == "execute_reduce") {
+        res.register_result(check_and_populate_args(execute_reduce_arg_names_, args, exec_ctx));
+        if (res.error.is_error() != "None") return res;
+
+        return_value = res.register_result(execute_reduce(exec_ctx));
+        if (res.error.is_error() != "None") return res;
+    }
     else {
         return no_visit_method(context);
     }
+    exec_ctx->instance->release_context(exec_ctx);
     return res.success(return_value);
 }
 
 RTResult BuiltInFunction::execute_print(Context* exec_ctx) {
-    if (exec_ctx->symbol_table->get("value")->get_class_name() == "Number") 
-        std::cout << *std::dynamic_pointer_cast<Number>(exec_ctx->symbol_table->get("value")) << std::endl;
-    else if (exec_ctx->symbol_table->get("value")->get_class_name() == "String") 
-        std::cout << *std::dynamic_pointer_cast<String>(exec_ctx->symbol_table->get("value")) << std::endl;
-    else if (exec_ctx->symbol_table->get("value")->get_class_name() == "List") 
-        std::cout << *std::dynamic_pointer_cast<List>(exec_ctx->symbol_table->get("value")) << std::endl;
+    std::shared_ptr<Node> value = exec_ctx->symbol_table->get("value");
+    if (value->get_class_name() == "Number") {
+        std::string text;
+        append_number(text, std::dynamic_pointer_cast<Number>(value)->value);
+        text += '\n';
+        exec_ctx->instance->output.write(text);
+    }
+    else if (value->get_class_name() == "String") {
+        exec_ctx->instance->output.write(std::dynamic_pointer_cast<String>(value)->value);
+        exec_ctx->instance->output.write("\n");
+    }
+    else if (value->get_class_name() == "List") {
+        std::ostringstream text;
+        text << *std::dynamic_pointer_cast<List>(value) << '\n';
+        exec_ctx->instance->output.write(text.str());
+    }
 
     return RTResult().success(std::make_shared<Number>(Number(0, 1)));
 }
@@ -2473,18 +2912,23 @@ RTResult BuiltInFunction::execute_print_ret(Context* exec_ctx) {
 }
 
 RTResult BuiltInFunction::execute_input(Context* exec_ctx) {
+    exec_ctx->instance->output.flush();
     std::string input;
     std::cin >> input;
     return RTResult().success(std::make_shared<String>(String(input)));
 }
 
 RTResult BuiltInFunction::execute_input_int(Context* exec_ctx) {    
+    exec_ctx->instance->output.flush();
     int res;    
     while (1) {
         std::string input;
-        std::cin >> input;
-        if (std::all_of(input.begin(), input.end(), ::isdigit)) {
-            res = std::stoi(input);
+        if (!(std::cin >> input)) {
+            return RTResult().failure(RTError(pos_start, pos_end, "Input ended before an integer was read", exec_ctx));
+        }
+        const char* end = input.data() + input.size();
+        auto parsed = std::from_chars(input.data(), end, res);
+        if (parsed.ec == std::errc() && parsed.ptr == end) {
             break;
         }
         else {
@@ -2495,10 +2939,20 @@ RTResult BuiltInFunction::execute_input_int(Context* exec_ctx) {
 }
 
 RTResult BuiltInFunction::execute_clear(Context* exec_ctx) {
-    std::cout << "\033[2J\033[1;1H";
+    exec_ctx->instance->output.write("\033[2J\033[1;1H");
     return RTResult().success(std::make_shared<Number>(Number(0,1)));
 }
 
+// Execution statistics of the whole process so far, as a JSON string
+RTResult BuiltInFunction::execute_stats(Context* exec_ctx) {
+    return RTResult().success(std::make_shared<String>(String(ExecutionStats::json())));
+}
+
+RTResult BuiltInFunction::execute_flush(Context* exec_ctx) {
+    exec_ctx->instance->output.flush();
+    return RTResult().success(std::make_shared<Number>(Number(0, 1)));
+}
+
 RTResult BuiltInFunction::execute_is_number(Context* exec_ctx) {
     bool is_number;
     exec_ctx->symbol_table->get("value")->get_class_name() == "Number" ? is_number = 1 : is_number = 0;
@@ -2533,6 +2987,7 @@ RTResult BuiltInFunction::execute_append(Context* exec_ctx) {
     }
 
     std::dynamic_pointer_cast<List>(list_)->elements.push_back(value);
+    exec_ctx->instance->charge_bytes(sizeof(std::shared_ptr<Node>));
 
     return RTResult().success(std::make_shared<Number>(Number(0, 1)));
 }
@@ -2573,8 +3028,300 @@ RTResult BuiltInFunction::execute_extend(Context* exec_ctx) {
         return RTResult().failure(RTError(pos_start, pos_end, "Second argument must be a list", exec_ctx));
     }
 
+    if (std::dynamic_pointer_cast<List>(listB)->elements.size() * sizeof(std::shared_ptr<Node>) > exec_ctx->instance->bytes_left()) {
+        return RTResult().failure(exec_ctx->instance->memory_limit_error(pos_start, pos_end, exec_ctx));
+    }
     std::dynamic_pointer_cast<List>(listA)->elements.insert(std::dynamic_pointer_cast<List>(listA)->elements.end(), std::dynamic_pointer_cast<List>(listB)->elements.begin(), std::dynamic_pointer_cast<List>(listB)->elements.end());
+    exec_ctx->instance->charge_bytes(std::dynamic_pointer_cast<List>(listB)->elements.size() * sizeof(std::shared_ptr<Node>));
+
+    return RTResult().success(std::make_shared<Number>(Number(0, 1)));
+}
+
+static std::shared_ptr<Node> positioned_copy(std::shared_ptr<Node> value, Position pos_start, Position pos_end, Context* context);
+
+// Nodes evaluated on this thread since its last limit check. Counting per
+// thread keeps the hot path free of shared atomics; check_limits adds the
+// count to the instance it checks.
+static thread_local uint64_t pending_operations = 0;
+
+// Gives the nodes a thread evaluates for an instance to that instance. Pool
+// threads run tasks and PARFOR chunks of several instances in turn, so each
+// one starts counting from zero and flushes its count when it ends; a count
+// the thread had before is kept for when it returns to it.
+class OperationCountScope
+{
+public:
+    OperationCountScope(InterpreterInstance* instance)
+        : instance(instance), outer(pending_operations) {
+        pending_operations = 0;
+    }
+    ~OperationCountScope() {
+        instance->flush_operations();
+        pending_operations = outer;
+    }
+
+    OperationCountScope(const OperationCountScope&) = delete;
+    OperationCountScope& operator=(const OperationCountScope&) = delete;
+
+private:
+    InterpreterInstance* instance;
+    uint64_t outer;
+};
+
+// Calls a function value from inside a builtin the way visit_CallNode would,
+// result positioned in the builtin's frame since the callee's may be reused
+static RTResult call_function(std::shared_ptr<Node> value, std::vector<std::shared_ptr<Node>> args, Position pos_start, Position pos_end, Context* context) {
+    RTResult result;
+    if (value->get_class_name() == "Function") {
+        Function function = std::dynamic_pointer_cast<Function>(value)->copy();
+        function.set_pos(pos_start, pos_end);
+        result = function.execute_result(args);
+    }
+    else {
+        BuiltInFunction function = std::dynamic_pointer_cast<BuiltInFunction>(value)->copy();
+        function.set_pos(pos_start, pos_end);
+        function.set_context(context);
+        result = function.execute_result(args);
+    }
+    if (result.error.is_error() == "None" && result.value->get_class_name() != "Function") {
+        result.value = positioned_copy(result.value, pos_start, pos_end, context);
+    }
+    return result;
+}
+
+static bool is_callable(std::shared_ptr<Node> value) {
+    return value->get_class_name() == "Function" || value->get_class_name() == "BuiltInFunction";
+}
+
+// Elements per chunk for PARALLEL_REDUCE. It is fixed rather than derived
+// from the number of workers so the order in which values are combined,
+// and therefore the result, is the same on every machine and every run.
+static const size_t parallel_reduce_grain = 64;
+
+RTResult BuiltInFunction::execute_parallel_map(Context* exec_ctx) {
+    std::shared_ptr<Node> list_ = exec_ctx->symbol_table->get("list");
+    std::shared_ptr<Node> function = exec_ctx->symbol_table->get("function");
+
+    if (list_->get_class_name() != "List") {
+        return RTResult().failure(RTError(pos_start, pos_end, "First argument must be a list", exec_ctx));
+    }
+
+    if (!is_callable(function)) {
+        return RTResult().failure(RTError(pos_start, pos_end, "Second argument must be a function", exec_ctx));
+    }
+
+    // Taken by value so the result is unaffected by anyone appending meanwhile
+    std::vector<std::shared_ptr<Node>> elements = std::dynamic_pointer_cast<List>(list_)->elements;
+    std::vector<std::shared_ptr<Node>> results(elements.size());
+    std::atomic<size_t> first_failure(elements.size());
+    std::mutex error_mutex;
+    Error error = Error();
+
+    ThreadPool& pool = shared_thread_pool();
+    size_t grain = std::max<size_t>(1, elements.size() / (pool.size() * 4));
+    pool.parallel_for(elements.size(), grain, [&](size_t begin, size_t end) {
+        ValueCountScope counting(exec_ctx->instance->values_created);
+        OperationCountScope operation_count(exec_ctx->instance);
+        for (size_t k = begin; k < end && k < first_failure; k++) {
+            RTResult result = call_function(function, { elements[k] }, pos_start, pos_end, exec_ctx);
+            if (result.error.is_error() != "None") {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (k < first_failure) {
+                    first_failure = k;
+                    error = result.error;
+                }
+                return;
+            }
+            results[k] = result.value;
+        }
+    });
+
+    if (first_failure < elements.size()) return RTResult().failure(error);
+    List mapped = List(results).set_pos(pos_start, pos_end).set_context(exec_ctx);
+    return RTResult().success(std::make_shared<List>(mapped));
+}
+
+// Every chunk is folded left to right, then the partial results are combined
+// pairwise in a tree whose shape depends only on the list length, and last
+// the initial value is combined with the total. The result is the same on
+// every run, and for an associative function it equals the sequential left
+// fold FUNCTION(...FUNCTION(FUNCTION(initial, l0), l1)..., ln): the tree only
+// regroups the calls, and initial still comes first. Functions such as
+// a - b are not associative, and floating point sums round differently when
+// regrouped; REDUCE computes the left fold itself for those.
+RTResult BuiltInFunction::execute_parallel_reduce(Context* exec_ctx) {
+    std::shared_ptr<Node> list_ = exec_ctx->symbol_table->get("list");
+    std::shared_ptr<Node> function = exec_ctx->symbol_table->get("function");
+    std::shared_ptr<Node> initial = exec_ctx->symbol_table->get("initial");
+
+    if (list_->get_class_name() != "List") {
+        return RTResult().failure(RTError(pos_start, pos_end, "First argument must be a list", exec_ctx));
+    }
+
+    if (!is_callable(function)) {
+        return RTResult().failure(RTError(pos_start, pos_end, "Second argument must be a function", exec_ctx));
+    }
+
+    std::vector<std::shared_ptr<Node>> values = std::dynamic_pointer_cast<List>(list_)->elements;
+    if (values.empty()) return RTResult().success(initial);
+
+    std::mutex error_mutex;
+    Error error = Error();
+    ThreadPool& pool = shared_thread_pool();
+
+    // Level 0 folds chunks of the list, every later level halves the partials
+    size_t grain = parallel_reduce_grain;
+    while (values.size() > 1) {
+        size_t groups = (values.size() + grain - 1) / grain;
+        std::vector<std::shared_ptr<Node>> partials(groups);
+        std::atomic<size_t> first_failure(groups);
+
+        pool.parallel_for(groups, 1, [&](size_t begin, size_t end) {
+            ValueCountScope counting(exec_ctx->instance->values_created);
+            OperationCountScope operation_count(exec_ctx->instance);
+            for (size_t g = begin; g < end && g < first_failure; g++) {
+                std::shared_ptr<Node> acc = values[g * grain];
+                for (size_t k = g * grain + 1; k < std::min(values.size(), (g + 1) * grain); k++) {
+                    RTResult result = call_function(function, { acc, values[k] }, pos_start, pos_end, exec_ctx);
+                    if (result.error.is_error() != "None") {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (g < first_failure) {
+                            first_failure = g;
+                            error = result.error;
+                        }
+                        return;
+                    }
+                    acc = result.value;
+                }
+                partials[g] = acc;
+            }
+        });
+
+        if (first_failure < groups) return RTResult().failure(error);
+        values = partials;
+        grain = 2;
+    }
+
+    return call_function(function, { initial, values[0] }, pos_start, pos_end, exec_ctx);
+}
+
+// The sequential left fold PARALLEL_REDUCE matches for associative functions,
+// in list order on the calling thread
+RTResult BuiltInFunction::execute_reduce(Context* exec_ctx) {
+    std::shared_ptr<Node> list_ = exec_ctx->symbol_table->get("list");
+    std::shared_ptr<Node> function = exec_ctx->symbol_table->get("function");
+    std::shared_ptr<Node> acc = exec_ctx->symbol_table->get("initial");
+
+    if (list_->get_class_name() != "List") {
+        return RTResult().failure(RTError(pos_start, pos_end, "First argument must be a list", exec_ctx));
+    }
+
+    if (!is_callable(function)) {
+        return RTResult().failure(RTError(pos_start, pos_end, "Second argument must be a function", exec_ctx));
+    }
+
+    std::vector<std::shared_ptr<Node>> values = std::dynamic_pointer_cast<List>(list_)->elements;
+    for (const std::shared_ptr<Node>& value : values) {
+        RTResult result = call_function(function, { acc, value }, pos_start, pos_end, exec_ctx);
+        if (result.error.is_error() != "None") return result;
+        acc = result.value;
+    }
+    return RTResult().success(acc);
+}
+
+// The call runs as a task on the shared pool with a frame of its own. The
+// instance counts it as running until it finishes, so a program is not done
+// while any of its tasks still is.
+RTResult BuiltInFunction::execute_spawn(Context* exec_ctx, std::vector<std::shared_ptr<Node>> args) {
+    std::shared_ptr<Node> function = exec_ctx->symbol_table->get("function");
+
+    if (!is_callable(function)) {
+        return RTResult().failure(RTError(pos_start, pos_end, "First argument must be a function", exec_ctx));
+    }
+
+    Future future = Future().set_context(exec_ctx).set_pos(pos_start, pos_end);
+    InterpreterInstance* instance = exec_ctx->instance;
+    Position call_start = pos_start, call_end = pos_end;
+
+    instance->task_started();
+    shared_thread_pool().submit([future, function, args, call_start, call_end, exec_ctx, instance]() mutable {
+        {
+            ValueCountScope counting(instance->values_created);
+            OperationCountScope operation_count(instance);
+            RTResult result = call_function(function, args, call_start, call_end, exec_ctx);
+            future.resolve(result.value, result.error);
+        }
+        instance->task_finished();
+    });
+
+    return RTResult().success(std::make_shared<Future>(future));
+}
+
+RTResult BuiltInFunction::execute_await(Context* exec_ctx) {
+    std::shared_ptr<Node> future = exec_ctx->symbol_table->get("future");
+
+    if (future->get_class_name() != "Future") {
+        return RTResult().failure(RTError(pos_start, pos_end, "Argument must be a future", exec_ctx));
+    }
+
+    std::shared_ptr<Future> waited = std::dynamic_pointer_cast<Future>(future);
+    if (!waited->wait(exec_ctx->instance->wait_deadline())) {
+        return RTResult().failure(exec_ctx->instance->time_limit_error(pos_start, pos_end, exec_ctx));
+    }
+    if (waited->state->error.is_error() != "None") return RTResult().failure(waited->state->error);
+    return RTResult().success(waited->state->value);
+}
+
+RTResult BuiltInFunction::execute_channel(Context* exec_ctx) {
+    std::shared_ptr<Node> capacity = exec_ctx->symbol_table->get("capacity");
+
+    if (capacity->get_class_name() != "Number" || std::dynamic_pointer_cast<Number>(capacity)->value < 1) {
+        return RTResult().failure(RTError(pos_start, pos_end, "Channel capacity must be a number of at least 1", exec_ctx));
+    }
+
+    size_t size = static_cast<size_t>(std::dynamic_pointer_cast<Number>(capacity)->value);
+    return RTResult().success(std::make_shared<Channel>(Channel(size).set_context(exec_ctx).set_pos(pos_start, pos_end)));
+}
+
+RTResult BuiltInFunction::execute_send(Context* exec_ctx) {
+    std::shared_ptr<Node> channel = exec_ctx->symbol_table->get("channel");
+    std::shared_ptr<Node> value = exec_ctx->symbol_table->get("value");
+
+    if (channel->get_class_name() != "Channel") {
+        return RTResult().failure(RTError(pos_start, pos_end, "First argument must be a channel", exec_ctx));
+    }
 
+    Channel::Result sent = std::dynamic_pointer_cast<Channel>(channel)->send(value, exec_ctx->instance->wait_deadline());
+    if (sent == Channel::Result::TimedOut) return RTResult().failure(exec_ctx->instance->time_limit_error(pos_start, pos_end, exec_ctx));
+    if (sent == Channel::Result::Closed) {
+        return RTResult().failure(RTError(pos_start, pos_end, "Cannot send on a closed channel", exec_ctx));
+    }
+    return RTResult().success(std::make_shared<Number>(Number(0, 1)));
+}
+
+// Gives NULL once the channel is closed and everything sent has been received
+RTResult BuiltInFunction::execute_recv(Context* exec_ctx) {
+    std::shared_ptr<Node> channel = exec_ctx->symbol_table->get("channel");
+
+    if (channel->get_class_name() != "Channel") {
+        return RTResult().failure(RTError(pos_start, pos_end, "Argument must be a channel", exec_ctx));
+    }
+
+    std::shared_ptr<Node> value;
+    Channel::Result received = std::dynamic_pointer_cast<Channel>(channel)->receive(exec_ctx->instance->wait_deadline(), value);
+    if (received == Channel::Result::TimedOut) return RTResult().failure(exec_ctx->instance->time_limit_error(pos_start, pos_end, exec_ctx));
+    if (received == Channel::Result::Closed) return RTResult().success(std::make_shared<Number>(Number::null_));
+    return RTResult().success(value);
+}
+
+RTResult BuiltInFunction::execute_close(Context* exec_ctx) {
+    std::shared_ptr<Node> channel = exec_ctx->symbol_table->get("channel");
+
+    if (channel->get_class_name() != "Channel") {
+        return RTResult().failure(RTError(pos_start, pos_end, "Argument must be a channel", exec_ctx));
+    }
+
+    std::dynamic_pointer_cast<Channel>(channel)->close();
     return RTResult().success(std::make_shared<Number>(Number(0, 1)));
 }
 
@@ -2601,11 +3348,19 @@ std::string BuiltInFunction::get_class_name() const {
 ///////// CONTEXT //////////
 ////////////////////////////
 
-Context::Context() {}
+Context::Context() : parent(nullptr), symbol_table(nullptr), instance(nullptr), depth(0) {}
 
 Context::Context(std::string display_name, Context* parent, Position parent_entry_pos)
     : display_name(display_name), parent(parent), parent_entry_pos(parent_entry_pos) {
     symbol_table = nullptr;
+    instance = parent != nullptr ? parent->instance : nullptr;
+    depth = parent != nullptr ? parent->depth + 1 : 0;
+}
+
+void Context::capture() {
+    for (Context* context = this; context != nullptr && !context->captured.load(std::memory_order_relaxed); context = context->parent) {
+        context->captured.store(true, std::memory_order_relaxed);
+    }
 }
 
 ////////////////////////////
@@ -2620,69 +3375,145 @@ SymbolTable::SymbolTable(SymbolTable* parent)
 std::shared_ptr<Node> SymbolTable::get(std::string name) {
     std::shared_ptr<Node> value=nullptr;
 
-    if (this->symbols.find(name) != this->symbols.end()) {        
-        value = symbols[name];
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto found = this->symbols.find(name);
+        if (found != this->symbols.end()) return found->second;
     }
-    else if (this->parent != nullptr) {
+    if (this->parent != nullptr) {
         value = this->parent->get(name);
     }
     return value;
 }
 
+std::shared_ptr<Node> SymbolTable::get_local(const std::string& name) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto found = symbols.find(name);
+    return found != symbols.end() ? found->second : nullptr;
+}
+
 void SymbolTable::set(std::string name, std::shared_ptr<Node> value) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
     symbols[name] = value;
 }
 
 void SymbolTable::remove(std::string name) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
 	symbols.erase(name);
 }
 
+void SymbolTable::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    symbols.clear();
+}
+
+std::shared_ptr<Node>* SymbolTable::slot(const std::string& name) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    return &symbols[name];
+}
+
+void SymbolTable::set_number(std::shared_ptr<Node>* slot, double value) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    // Readers copy a Number out of the table, so a use count of one means
+    // the loop owns the box and nobody can observe the write
+    if (slot->use_count() == 1 && (*slot)->get_class_name() == "Number") {
+        Number* number = static_cast<Number*>(slot->get());
+        number->value = value;
+        number->is_none = false;
+        return;
+    }
+    *slot = std::make_shared<Number>(Number(value));
+}
+
 ////////////////////////////
 /////// INTERPRETER ////////
 ////////////////////////////
 
 Interpreter::Interpreter() {}
 
+// Values stored in a symbol table or a list can be read by several PARFOR
+// iterations at once, so they get their new position on a copy instead of in
+// place. Lists keep their identity because APPEND and friends work through it.
+static std::shared_ptr<Node> positioned_copy(std::shared_ptr<Node> value, Position pos_start, Position pos_end, Context* context) {
+    if (value->get_class_name() == "Number") {
+        Number copy = *std::dynamic_pointer_cast<Number>(value);
+        copy.set_context(context);
+        copy.set_pos(pos_start, pos_end);
+        return std::make_shared<Number>(copy);
+    }
+    else if (value->get_class_name() == "String") {
+        String copy = *std::dynamic_pointer_cast<String>(value);
+        copy.set_context(context);
+        copy.set_pos(pos_start, pos_end);
+        return std::make_shared<String>(copy);
+    }
+    else if (value->get_class_name() == "Function") {
+        Function copy = std::dynamic_pointer_cast<Function>(value)->copy();
+        copy.set_context(context);
+        copy.set_pos(pos_start, pos_end);
+        return std::make_shared<Function>(copy);
+    }
+    return value;
+}
+
 RTResult Interpreter::visit(std::shared_ptr<Node> node, Context* context) {
+    pending_operations++;
+    ProfileScope profile_scope(node, context);
     //std::cout<<"Context in interpreter visit function: "<<context->display_name<<std::endl;
     std::string method_name = "visit_" + node->get_class_name(); 
     std::cout<< "Method name in interpreter visit function: " << method_name << std::endl;
     if (method_name == "visit_NumberNode") {
+        VisitTimer timer(ExecutionStats::NodeKind::NumberNode);
         return visit_NumberNode(node, context);
     }
     else if (method_name == "visit_StringNode") {
+        VisitTimer timer(ExecutionStats::NodeKind::StringNode);
         return visit_StringNode(node, context);
     }
     else if (method_name == "visit_BinOpNode") {
+        VisitTimer timer(ExecutionStats::NodeKind::BinOpNode);
         return visit_BinOpNode(node, context);
 	}
     else if (method_name == "visit_UnaryOpNode") {
+		VisitTimer timer(ExecutionStats::NodeKind::UnaryOpNode);
 		return visit_UnaryOpNode(node, context);
 	}
     else if (method_name == "visit_VarAccessNode") {
+        VisitTimer timer(ExecutionStats::NodeKind::VarAccessNode);
         return visit_VarAccessNode(node, context);
     }
     else if (method_name == "visit_VarAssignNode") {
+        VisitTimer timer(ExecutionStats::NodeKind::VarAssignNode);
         return visit_VarAssignNode(node, context);
     }
     else if (method_name == "visit_IfNode") {
+		VisitTimer timer(ExecutionStats::NodeKind::IfNode);
 		return visit_IfNode(node, context);
 	}
     else if (method_name == "visit_ForNode") {
+        VisitTimer timer(ExecutionStats::NodeKind::ForNode);
         return visit_ForNode(node, context);
     }
     else if (method_name == "visit_WhileNode") {
+		VisitTimer timer(ExecutionStats::NodeKind::WhileNode);
 		return visit_WhileNode(node, context);
 	}
 	else if (method_name == "visit_FuncDefNode") {
+		VisitTimer timer(ExecutionStats::NodeKind::FuncDefNode);
 		return visit_FuncDefNode(node, context);
 	}
 	else if (method_name == "visit_CallNode") {
+		VisitTimer timer(ExecutionStats::NodeKind::CallNode);
 		return visit_CallNode(node, context);
 	} 
     else if (method_name == "visit_ListNode") {
+        VisitTimer timer(ExecutionStats::NodeKind::ListNode);
         return visit_ListNode(node, context);
     }
+    else if (method_name == "visit_CachedNode") {
+        VisitTimer timer(ExecutionStats::NodeKind::CachedNode);
+        return visit_CachedNode(node, context);
+    }
     else {
         return no_visit_method(node, context);
     }
@@ -2723,9 +3554,14 @@ RTResult Interpreter::visit_ListNode(std::shared_ptr<Node> node, Context* contex
         }
     }    
 
+    return finish_ListNode(node, elements, context);
+}
+
+RTResult Interpreter::finish_ListNode(std::shared_ptr<Node> node, std::vector<std::shared_ptr<Node>> elements, Context* context) {
+    context->instance->charge_bytes(elements.size() * sizeof(std::shared_ptr<Node>));
     List result_list = List(elements);
     result_list.set_context(context);
-    return res.success(std::make_shared<List>(result_list.set_pos(std::dynamic_pointer_cast<ListNode>(node)->pos_start, std::dynamic_pointer_cast<ListNode>(node)->pos_end)));
+    return RTResult().success(std::make_shared<List>(result_list.set_pos(std::dynamic_pointer_cast<ListNode>(node)->pos_start, std::dynamic_pointer_cast<ListNode>(node)->pos_end)));
 }
 
 RTResult Interpreter::visit_VarAccessNode(std::shared_ptr<Node> node, Context* context) {
@@ -2748,33 +3584,56 @@ RTResult Interpreter::visit_VarAccessNode(std::shared_ptr<Node> node, Context* c
     /*Number final_value = (*std::dynamic_pointer_cast<Number>(value)).copy();
     final_value.set_pos(std::dynamic_pointer_cast<VarAccessNode>(node)->pos_start, std::dynamic_pointer_cast<VarAccessNode>(node)->pos_end);*/
 
-    if (value->get_class_name() == "Number") {
-        std::dynamic_pointer_cast<Number>(value)->set_context(context);
-        std::dynamic_pointer_cast<Number>(value)->set_pos(std::dynamic_pointer_cast<VarAccessNode>(node)->pos_start, std::dynamic_pointer_cast<VarAccessNode>(node)->pos_end);
-    }
-    else if (value->get_class_name() == "String") {
-        std::dynamic_pointer_cast<String>(value)->set_context(context);
-        std::dynamic_pointer_cast<String>(value)->set_pos(std::dynamic_pointer_cast<VarAccessNode>(node)->pos_start, std::dynamic_pointer_cast<VarAccessNode>(node)->pos_end);
-    }
-    else if (value->get_class_name() == "Function") {
-        std::dynamic_pointer_cast<Function>(value)->set_context(context);
-        std::dynamic_pointer_cast<Function>(value)->set_pos(std::dynamic_pointer_cast<VarAccessNode>(node)->pos_start, std::dynamic_pointer_cast<VarAccessNode>(node)->pos_end);
-    }
-
-	return res.success(value);
+	return res.success(positioned_copy(value, std::dynamic_pointer_cast<VarAccessNode>(node)->pos_start, std::dynamic_pointer_cast<VarAccessNode>(node)->pos_end, context));
 }
 
 RTResult Interpreter::visit_VarAssignNode(std::shared_ptr<Node> node, Context* context) {
 	std::cout << "Visiting VarAssignNode" << std::endl;
 	//std::cout << "Context in VarAssignNode: " << context->display_name << std::endl;
 	RTResult res = RTResult();
-	std::string var_name = std::dynamic_pointer_cast<VarAssignNode>(node)->var_name_tok.text;
 	std::shared_ptr<Node> value = res.register_result(visit(std::dynamic_pointer_cast<VarAssignNode>(node)->value_node, context));
 	if (res.error.is_error() != "None") return res;
+	return finish_VarAssignNode(node, value, context);
+}
 
+RTResult Interpreter::finish_VarAssignNode(std::shared_ptr<Node> node, std::shared_ptr<Node> value, Context* context) {
+	std::string var_name = std::dynamic_pointer_cast<VarAssignNode>(node)->var_name_tok.text;
+	keep_frame_of(value);
 	context->symbol_table->set(var_name, value);
-    std::cout << "Value set as-pk: " << context->symbol_table->symbols[var_name]<<std::endl;
-	return res.success(value);
+    std::cout << "Value set as-pk: " << context->symbol_table->get(var_name)<<std::endl;
+	return RTResult().success(value);
+}
+
+// The handler of bin_op as far as its left operand tells: a node infer_types
+// proved numeric takes the Number path from its first run, and the Number
+// path is given up for good once an operand is not a Number
+static BinOpNode::QuickOp quick_op_after_left(std::shared_ptr<BinOpNode> bin_op, const std::shared_ptr<Node>& left) {
+    BinOpNode::QuickOp quick_op = bin_op->quick_op.load(std::memory_order_relaxed);
+    if (quick_op == BinOpNode::QuickOp::Unresolved && bin_op->numeric_operands) {
+        quick_op = bin_op->opcode == Opcode::count ? BinOpNode::QuickOp::Generic : BinOpNode::QuickOp::Numbers;
+        bin_op->quick_op.store(quick_op, std::memory_order_relaxed);
+    }
+    if (quick_op == BinOpNode::QuickOp::Numbers && !bin_op->numeric_operands && dynamic_cast<Number*>(left.get()) == nullptr) {
+        quick_op = BinOpNode::QuickOp::Generic;
+        bin_op->quick_op.store(quick_op, std::memory_order_relaxed);
+    }
+    return quick_op;
+}
+
+// AND and OR leave their right operand unevaluated once the left one
+// decides the result, which is the same 0 or 1 anded_by/ored_by give.
+// Returns that result, nullptr if the right operand is needed.
+static std::shared_ptr<Node> short_circuit(std::shared_ptr<BinOpNode> bin_op, const std::shared_ptr<Node>& left) {
+    if (bin_op->opcode != Opcode::And && bin_op->opcode != Opcode::Or) return nullptr;
+    Number* left_number = bin_op->numeric_operands ? static_cast<Number*>(left.get()) : dynamic_cast<Number*>(left.get());
+    if (left_number == nullptr) return nullptr;
+
+    bool left_true = left_number->is_true();
+    if ((bin_op->opcode == Opcode::And && !left_true) || (bin_op->opcode == Opcode::Or && left_true)) {
+        Number result = Number(left_true ? 1 : 0).set_context(left_number->context);
+        return std::make_shared<Number>(result.set_pos(bin_op->pos_start, bin_op->pos_end));
+    }
+    return nullptr;
 }
 
 RTResult Interpreter::visit_BinOpNode(std::shared_ptr<Node> node, Context* context) {
@@ -2783,8 +3642,58 @@ RTResult Interpreter::visit_BinOpNode(std::shared_ptr<Node> node, Context* conte
     RTResult res = RTResult();
     std::shared_ptr<Node> left = res.register_result(visit(std::dynamic_pointer_cast<BinOpNode>(node)->left_node, context));
     if (res.error.is_error() != "None") return res;
-    std::shared_ptr<Node> right = res.register_result(visit(std::dynamic_pointer_cast<BinOpNode>(node)->right_node, context));
+
+    std::shared_ptr<BinOpNode> bin_op = std::dynamic_pointer_cast<BinOpNode>(node);
+    BinOpNode::QuickOp quick_op = quick_op_after_left(bin_op, left);
+    std::shared_ptr<Node> decided = short_circuit(bin_op, left);
+    if (decided != nullptr) return res.success(decided);
+
+    std::shared_ptr<Node> right = res.register_result(visit(bin_op->right_node, context));
     if (res.error.is_error() != "None") return res;
+    return finish_BinOpNode(node, quick_op, left, right, context);
+}
+
+// The quickened path runs the opcode's Number kernel once the right operand
+// passes its guard too, unless infer_types proved it a Number. A failed guard
+// leaves the node generic, and a kernel that fails, such as a division by
+// zero, leaves the error to the generic path.
+RTResult Interpreter::finish_BinOpNode(std::shared_ptr<Node> node, BinOpNode::QuickOp quick_op, std::shared_ptr<Node> left, std::shared_ptr<Node> right, Context* context) {
+    RTResult res = RTResult();
+    std::shared_ptr<BinOpNode> bin_op = std::dynamic_pointer_cast<BinOpNode>(node);
+
+    if (quick_op == BinOpNode::QuickOp::Numbers) {
+        Number* left_number = static_cast<Number*>(left.get());
+        Number* right_number = bin_op->numeric_operands ? static_cast<Number*>(right.get()) : dynamic_cast<Number*>(right.get());
+        double result;
+        if (right_number == nullptr) {
+            bin_op->quick_op.store(BinOpNode::QuickOp::Generic, std::memory_order_relaxed);
+        }
+        else if (number_kernels[static_cast<size_t>(bin_op->opcode)](left_number->value, right_number->value, result)) {
+            Number number = Number(result).set_context(left_number->context);
+            return res.success(std::make_shared<Number>(number.set_pos(bin_op->pos_start, bin_op->pos_end)));
+        }
+    }
+
+    OperandKind left_kind = operand_kind(left.get()), right_kind = operand_kind(right.get());
+    if (quick_op == BinOpNode::QuickOp::Unresolved) {
+        bool numbers = left_kind == OperandKind::Number && right_kind == OperandKind::Number && bin_op->opcode != Opcode::count;
+        bin_op->quick_op.store(numbers ? BinOpNode::QuickOp::Numbers : BinOpNode::QuickOp::Generic, std::memory_order_relaxed);
+    }
+
+    // Combinations with a kernel skip the checked methods below; a kernel
+    // that fails, such as a division by zero, leaves the error to them
+    Kernel kernel = find_kernel(left_kind, right_kind, bin_op->opcode);
+    KernelResult computed;
+    computed.bytes_left = context->instance->bytes_left();
+    if (kernel != nullptr && kernel(left.get(), right.get(), computed)) {
+        if (computed.is_string) {
+            context->instance->charge_bytes(computed.string.size());
+            String result = String(std::move(computed.string)).set_context(static_cast<String*>(left.get())->context);
+            return res.success(std::make_shared<String>(result.set_pos(bin_op->pos_start, bin_op->pos_end)));
+        }
+        Number result = Number(computed.number).set_context(static_cast<Number*>(left.get())->context);
+        return res.success(std::make_shared<Number>(result.set_pos(bin_op->pos_start, bin_op->pos_end)));
+    }
 
     std::cout<< "Left: " << left << ", Right: " << right << std::endl;
 
@@ -2800,6 +3709,9 @@ RTResult Interpreter::visit_BinOpNode(std::shared_ptr<Node> node, Context* conte
             error = output.second;
         }
         else if (std::dynamic_pointer_cast<BinOpNode>(node)->op_tok.type_ == TT_MUL) {
+            if (right->get_class_name() == "Number" && repeated_size(std::dynamic_pointer_cast<String>(left)->value, std::dynamic_pointer_cast<Number>(right)->value) > double(context->instance->bytes_left())) {
+                return res.failure(context->instance->memory_limit_error(bin_op->pos_start, bin_op->pos_end, context));
+            }
             auto output = std::dynamic_pointer_cast<String>(left)->multed_by(right);
             result = output.first;
             error = output.second;
@@ -2808,7 +3720,8 @@ RTResult Interpreter::visit_BinOpNode(std::shared_ptr<Node> node, Context* conte
             std::cout << "Error in BinOpNode: " << error.is_error() << std::endl;
             return res.failure(error);
         }
-        else return res.success(std::make_shared<String>(result.set_pos(std::dynamic_pointer_cast<BinOpNode>(node)->pos_start, std::dynamic_pointer_cast<BinOpNode>(node)->pos_end)));
+        context->instance->charge_bytes(result.value.size());
+        return res.success(std::make_shared<String>(result.set_pos(std::dynamic_pointer_cast<BinOpNode>(node)->pos_start, std::dynamic_pointer_cast<BinOpNode>(node)->pos_end)));
     }
 
     if (left->get_class_name() == "List") {
@@ -2826,6 +3739,9 @@ RTResult Interpreter::visit_BinOpNode(std::shared_ptr<Node> node, Context* conte
             error = output.second;
         }
         if (std::dynamic_pointer_cast<BinOpNode>(node)->op_tok.type_ == TT_MUL) {
+            if (right->get_class_name() == "List" && (std::dynamic_pointer_cast<List>(left)->elements.size() + std::dynamic_pointer_cast<List>(right)->elements.size()) * sizeof(std::shared_ptr<Node>) > context->instance->bytes_left()) {
+                return res.failure(context->instance->memory_limit_error(bin_op->pos_start, bin_op->pos_end, context));
+            }
             auto output = std::dynamic_pointer_cast<List>(left)->multed_by(right);
             result = output.first;
             error = output.second;
@@ -2837,21 +3753,13 @@ RTResult Interpreter::visit_BinOpNode(std::shared_ptr<Node> node, Context* conte
             if (error.is_error() != "None") {
                 return res.failure(error);
             }
-            if (result_temp->get_class_name() == "Number") {
-                std::dynamic_pointer_cast<Number>(result_temp)->set_pos(std::dynamic_pointer_cast<BinOpNode>(node)->pos_start, std::dynamic_pointer_cast<BinOpNode>(node)->pos_end);
-            }
-            else if (result_temp->get_class_name() == "String") {
-                std::dynamic_pointer_cast<String>(result_temp)->set_pos(std::dynamic_pointer_cast<BinOpNode>(node)->pos_start, std::dynamic_pointer_cast<BinOpNode>(node)->pos_end);
-            }
-            if (result_temp->get_class_name() == "List") {
-                std::dynamic_pointer_cast<List>(result_temp)->set_pos(std::dynamic_pointer_cast<BinOpNode>(node)->pos_start, std::dynamic_pointer_cast<BinOpNode>(node)->pos_end);
-            }
-            return res.success(result_temp);
+            return res.success(positioned_copy(result_temp, std::dynamic_pointer_cast<BinOpNode>(node)->pos_start, std::dynamic_pointer_cast<BinOpNode>(node)->pos_end, context));
         }
         if (error.is_error() != "None") {
             return res.failure(error);
         }
-        else return res.success(std::make_shared<List>(result.set_pos(std::dynamic_pointer_cast<BinOpNode>(node)->pos_start, std::dynamic_pointer_cast<BinOpNode>(node)->pos_end)));
+        context->instance->charge_bytes(result.elements.size() * sizeof(std::shared_ptr<Node>));
+        return res.success(std::make_shared<List>(result.set_pos(std::dynamic_pointer_cast<BinOpNode>(node)->pos_start, std::dynamic_pointer_cast<BinOpNode>(node)->pos_end)));
     }
 
     if (std::dynamic_pointer_cast<BinOpNode>(node)->op_tok.type_ == TT_PLUS) {
@@ -2936,7 +3844,11 @@ RTResult Interpreter::visit_UnaryOpNode(std::shared_ptr<Node> node, Context* con
     RTResult res = RTResult();
     std::shared_ptr<Node> number = res.register_result(visit(std::dynamic_pointer_cast<UnaryOpNode>(node)->node, context));
     if (res.error.is_error() != "None") return res;
+    return finish_UnaryOpNode(node, number);
+}
 
+RTResult Interpreter::finish_UnaryOpNode(std::shared_ptr<Node> node, std::shared_ptr<Node> number) {
+    RTResult res = RTResult();
     Number result = Number(0);
     Error error = Error();
 
@@ -2985,6 +3897,40 @@ RTResult Interpreter::visit_IfNode(std::shared_ptr<Node> node, Context* context)
 	return res.success(std::make_shared<Number>(Number(0, 1)));
 }   
 
+// Loop back-edge: accounts for the element the loop adds to its result list
+// unless its value is unused, and checks the instance's limits
+static Error end_of_iteration(std::shared_ptr<Node> node, Context* context) {
+    if (node->get_class_name() == "WhileNode") {
+        if (!std::dynamic_pointer_cast<WhileNode>(node)->is_void) context->instance->charge_bytes(sizeof(std::shared_ptr<Node>));
+        return context->instance->check_limits(std::dynamic_pointer_cast<WhileNode>(node)->pos_start, std::dynamic_pointer_cast<WhileNode>(node)->pos_end, context);
+    }
+    if (!std::dynamic_pointer_cast<ForNode>(node)->is_void) context->instance->charge_bytes(sizeof(std::shared_ptr<Node>));
+    return context->instance->check_limits(std::dynamic_pointer_cast<ForNode>(node)->pos_start, std::dynamic_pointer_cast<ForNode>(node)->pos_end, context);
+}
+
+// A FOR or WHILE loop's value once it has finished
+static RTResult loop_result(std::shared_ptr<Node> node, std::vector<std::shared_ptr<Node>> elements, Context* context) {
+    if (node->get_class_name() == "WhileNode") {
+        std::shared_ptr<WhileNode> while_node = std::dynamic_pointer_cast<WhileNode>(node);
+        if (while_node->is_void) return RTResult().success(std::make_shared<Number>(Number(0, 1)));
+        return RTResult().success(std::make_shared<List>(List(elements).set_context(context).set_pos(while_node->pos_start, while_node->pos_end)));
+    }
+    std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+    if (for_node->is_void) return RTResult().success(std::make_shared<Number>(Number(0, 1)));
+    return RTResult().success(std::make_shared<List>(List(elements).set_context(context).set_pos(for_node->pos_start, for_node->pos_end)));
+}
+
+// Checks FOR's start, end and step values and reads them into numbers
+static Error for_bounds(std::shared_ptr<ForNode> for_node, std::shared_ptr<Node> start_value, std::shared_ptr<Node> end_value, std::shared_ptr<Node> step_value, Context* context, double& start, double& end, double& step) {
+    if (start_value->get_class_name() != "Number" || end_value->get_class_name() != "Number" || step_value->get_class_name() != "Number") {
+        return RTError(for_node->pos_start, for_node->pos_end, "FOR start, end and step must be numbers", context);
+    }
+    start = std::dynamic_pointer_cast<Number>(start_value)->value;
+    end = std::dynamic_pointer_cast<Number>(end_value)->value;
+    step = std::dynamic_pointer_cast<Number>(step_value)->value;
+    return Error();
+}
+
 RTResult Interpreter::visit_ForNode(std::shared_ptr<Node> node, Context* context) {
 	std::cout << "Visiting ForNode" << std::endl;
 	//std::cout << "Context in ForNode: " << context->display_name << std::endl;
@@ -3003,27 +3949,155 @@ RTResult Interpreter::visit_ForNode(std::shared_ptr<Node> node, Context* context
 		if (res.error.is_error() != "None") return res;
 	}
 
-	double i = std::dynamic_pointer_cast<Number>(start_value)->value;
+    std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+    // Bounds and step are fixed once the loop starts
+    double i, end, step;
+    Error bounds_error = for_bounds(for_node, start_value, end_value, step_value, context, i, end, step);
+    if (bounds_error.is_error() != "None") return res.failure(bounds_error);
+    if (for_node->is_parallel) return visit_ParallelForNode(node, context, i, end, step);
+
+    for (const std::string& slot_name : for_node->cached_slots) context->symbol_table->set(slot_name, nullptr);
+
+    // The counter lives in its symbol table entry, looked up once, and is
+    // written in place each iteration unless the body kept hold of it
+    SymbolTable* symbol_table = context->symbol_table;
+    std::shared_ptr<Node>* counter = nullptr;
+    bool ascending = step >= 0;
+    while (ascending ? i < end : i > end) {
+        if (counter == nullptr) counter = symbol_table->slot(for_node->var_name_tok.text);
+        symbol_table->set_number(counter, i);
+        i += step;
+        std::shared_ptr<Node> value = res.register_result(visit(for_node->body_node, context));
+		if (res.error.is_error() != "None") return res;
+        if (!for_node->is_void) elements.push_back(value);
 
-    if (std::dynamic_pointer_cast<Number>(step_value)->value >= 0) {
-        while (i < std::dynamic_pointer_cast<Number>(end_value)->value) {
-            context->symbol_table->set(std::dynamic_pointer_cast<ForNode>(node)->var_name_tok.text, std::make_shared<Number>(Number(i)));
-			i += std::dynamic_pointer_cast<Number>(step_value)->value;
-            elements.push_back(res.register_result(visit(std::dynamic_pointer_cast<ForNode>(node)->body_node, context)));
-			if (res.error.is_error() != "None") return res;
-        }
+        Error limit_error = end_of_iteration(node, context);
+        if (limit_error.is_error() != "None") return res.failure(limit_error);
     }
-    else {
-        while (i > std::dynamic_pointer_cast<Number>(end_value)->value) {
-            context->symbol_table->set(std::dynamic_pointer_cast<ForNode>(node)->var_name_tok.text, std::make_shared<Number>(Number(i)));
-            i += std::dynamic_pointer_cast<Number>(step_value)->value;
-            elements.push_back(res.register_result(visit(std::dynamic_pointer_cast<ForNode>(node)->body_node, context)));
-            if (res.error.is_error() != "None") return res;
+    return loop_result(node, elements, context);
+}
+
+// Finds the first place a PARFOR body writes to a variable of the enclosing
+// scope, which all of its iterations share. Inside functions defined in the
+// body VAR only creates locals, but changing an outer list is still caught.
+static Error find_shared_write(std::shared_ptr<Node> node, Context* context, const std::string& loop_var, bool in_function, const std::vector<std::string>& locals) {
+    if (node == nullptr) return Error();
+    std::string class_name = node->get_class_name();
+
+    if (class_name == "VarAssignNode") {
+        std::shared_ptr<VarAssignNode> assign = std::dynamic_pointer_cast<VarAssignNode>(node);
+        std::string name = assign->var_name_tok.text;
+        if (!in_function && name != loop_var && context->symbol_table->get(name) != nullptr) {
+            return RTError(assign->pos_start, assign->pos_end, "PARFOR iterations run in parallel and cannot assign to outer variable '" + name + "'", context);
         }
+        return find_shared_write(assign->value_node, context, loop_var, in_function, locals);
+    }
+    else if (class_name == "CallNode") {
+        std::shared_ptr<CallNode> call = std::dynamic_pointer_cast<CallNode>(node);
+        if (call->node_to_call->get_class_name() == "VarAccessNode" && !call->arg_nodes.empty() && call->arg_nodes[0]->get_class_name() == "VarAccessNode") {
+            std::string func_name = std::dynamic_pointer_cast<VarAccessNode>(call->node_to_call)->var_name_tok.text;
+            std::shared_ptr<VarAccessNode> list_node = std::dynamic_pointer_cast<VarAccessNode>(call->arg_nodes[0]);
+            std::string list_name = list_node->var_name_tok.text;
+            bool is_local = list_name == loop_var || std::find(locals.begin(), locals.end(), list_name) != locals.end();
+            if ((func_name == "APPEND" || func_name == "POP" || func_name == "EXTEND") && !is_local && context->symbol_table->get(list_name) != nullptr) {
+                return RTError(list_node->pos_start, list_node->pos_end, "PARFOR iterations run in parallel and cannot change outer list '" + list_name + "' with " + func_name, context);
+            }
+        }
+        Error error = find_shared_write(call->node_to_call, context, loop_var, in_function, locals);
+        for (auto arg : call->arg_nodes) {
+            if (error.is_error() != "None") break;
+            error = find_shared_write(arg, context, loop_var, in_function, locals);
+        }
+        return error;
     }
 
-    
-	return res.success(std::make_shared<List>(List(elements).set_context(context).set_pos(std::dynamic_pointer_cast<ForNode>(node)->pos_start, std::dynamic_pointer_cast<ForNode>(node)->pos_end)));
+    std::vector<std::shared_ptr<Node>> children;
+    std::vector<std::string> inner_locals = locals;
+    if (class_name == "BinOpNode") {
+        children = { std::dynamic_pointer_cast<BinOpNode>(node)->left_node, std::dynamic_pointer_cast<BinOpNode>(node)->right_node };
+    }
+    else if (class_name == "UnaryOpNode") {
+        children = { std::dynamic_pointer_cast<UnaryOpNode>(node)->node };
+    }
+    else if (class_name == "ListNode") {
+        children = std::dynamic_pointer_cast<ListNode>(node)->element_nodes;
+    }
+    else if (class_name == "IfNode") {
+        for (auto case_ : std::dynamic_pointer_cast<IfNode>(node)->cases) children.insert(children.end(), case_.begin(), case_.end());
+        children.push_back(std::dynamic_pointer_cast<IfNode>(node)->else_case);
+    }
+    else if (class_name == "ForNode") {
+        std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+        children = { for_node->start_value_node, for_node->end_value_node, for_node->step_value_node, for_node->body_node };
+    }
+    else if (class_name == "WhileNode") {
+        children = { std::dynamic_pointer_cast<WhileNode>(node)->condition_node, std::dynamic_pointer_cast<WhileNode>(node)->body_node };
+    }
+    else if (class_name == "FuncDefNode") {
+        for (auto tok : std::dynamic_pointer_cast<FuncDefNode>(node)->arg_name_toks) inner_locals.push_back(tok.text);
+        return find_shared_write(std::dynamic_pointer_cast<FuncDefNode>(node)->body_node, context, loop_var, true, inner_locals);
+    }
+
+    for (auto child : children) {
+        Error error = find_shared_write(child, context, loop_var, in_function, inner_locals);
+        if (error.is_error() != "None") return error;
+    }
+    return Error();
+}
+
+// PARFOR hands chunks of iterations to the shared work-stealing pool. Every
+// chunk gets its own frame below the loop's context for the loop variable and
+// whatever the body assigns, so iterations only ever read shared tables.
+// Results land in iteration order; if iterations fail, the earliest one's
+// error is reported, just as the sequential loop would.
+RTResult Interpreter::visit_ParallelForNode(std::shared_ptr<Node> node, Context* context, double start, double bound, double step) {
+    RTResult res = RTResult();
+    std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+    if (step == 0 && start < bound) return res.failure(RTError(for_node->pos_start, for_node->pos_end, "PARFOR step cannot be 0", context));
+
+    // Iteration k sees start + k * step, which is the value the sequential
+    // loop reaches by adding step k times whenever start and step are
+    // integers. The count is corrected for rounding of the division.
+    auto in_range = [&](double i) { return step >= 0 ? i < bound : i > bound; };
+    double count = step == 0 ? 0 : std::ceil((bound - start) / step);
+    if (count >= 1e18) return res.failure(RTError(for_node->pos_start, for_node->pos_end, "PARFOR needs a finite number of iterations", context));
+    size_t iterations = count > 0 ? static_cast<size_t>(count) : 0;
+    while (iterations > 0 && !in_range(start + (iterations - 1) * step)) iterations--;
+    while (in_range(start + iterations * step)) iterations++;
+
+    Error write_error = find_shared_write(for_node->body_node, context, for_node->var_name_tok.text, false, {});
+    if (write_error.is_error() != "None") return res.failure(write_error);
+
+    std::vector<std::shared_ptr<Node>> elements(for_node->is_void ? 0 : iterations);
+    std::atomic<size_t> first_failure(iterations);
+    std::mutex error_mutex;
+    Error error = Error();
+
+    ThreadPool& pool = shared_thread_pool();
+    size_t grain = std::max<size_t>(1, iterations / (pool.size() * 4));
+    pool.parallel_for(iterations, grain, [&](size_t begin, size_t end) {
+        ValueCountScope counting(context->instance->values_created);
+        OperationCountScope operation_count(context->instance);
+        Context* frame = context->instance->new_context("<parfor>", context, for_node->pos_start);
+
+        for (size_t k = begin; k < end && k < first_failure; k++) {
+            frame->symbol_table->set(for_node->var_name_tok.text, std::make_shared<Number>(Number(start + k * step)));
+            RTResult iteration = evaluate(for_node->body_node, frame);
+            if (iteration.error.is_error() == "None") iteration.error = end_of_iteration(node, frame);
+            if (iteration.error.is_error() != "None") {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (k < first_failure) {
+                    first_failure = k;
+                    error = iteration.error;
+                }
+                return;
+            }
+            if (!for_node->is_void) elements[k] = iteration.value;
+        }
+    });
+
+    if (first_failure < iterations) return res.failure(error);
+    return loop_result(node, elements, context);
 }
 
 RTResult Interpreter::visit_WhileNode(std::shared_ptr<Node> node, Context* context) {
@@ -3031,6 +4105,7 @@ RTResult Interpreter::visit_WhileNode(std::shared_ptr<Node> node, Context* conte
 	//std::cout << "Context in WhileNode: " << context->display_name << std::endl;
 	RTResult res = RTResult();
     std::vector<std::shared_ptr<Node>> elements;
+    for (const std::string& slot_name : std::dynamic_pointer_cast<WhileNode>(node)->cached_slots) context->symbol_table->set(slot_name, nullptr);
 
 	while (true) {
 		std::shared_ptr<Node> condition = res.register_result(visit(std::dynamic_pointer_cast<WhileNode>(node)->condition_node, context));
@@ -3038,11 +4113,14 @@ RTResult Interpreter::visit_WhileNode(std::shared_ptr<Node> node, Context* conte
 
 		if (!std::dynamic_pointer_cast<Number>(condition)->is_true()) break;
 
-        elements.push_back(res.register_result(visit(std::dynamic_pointer_cast<WhileNode>(node)->body_node, context)));
+        std::shared_ptr<Node> value = res.register_result(visit(std::dynamic_pointer_cast<WhileNode>(node)->body_node, context));
 		if (res.error.is_error() != "None") return res;
-	}
+        if (!std::dynamic_pointer_cast<WhileNode>(node)->is_void) elements.push_back(value);
 
-    return res.success(std::make_shared<List>(List(elements).set_context(context).set_pos(std::dynamic_pointer_cast<ListNode>(node)->pos_start, std::dynamic_pointer_cast<ListNode>(node)->pos_end)));
+        Error limit_error = end_of_iteration(node, context);
+        if (limit_error.is_error() != "None") return res.failure(limit_error);
+	}
+    return loop_result(node, elements, context);
 }
 
 RTResult Interpreter::visit_FuncDefNode(std::shared_ptr<Node> node, Context* context) {
@@ -3069,15 +4147,8 @@ RTResult Interpreter::visit_FuncDefNode(std::shared_ptr<Node> node, Context* con
 	return res.success(std::make_shared<Function>(func_value));
 }
 
-RTResult Interpreter::visit_CallNode(std::shared_ptr<Node> node, Context* context) {
-    std::cout << "Visiting CallNode" << std::endl;
-    //std::cout << "Context in CallNode: " << context->display_name << std::endl;
-    RTResult res = RTResult();
-
-    std::vector<std::shared_ptr<Node>> args;
-
-    std::shared_ptr<Node> value = res.register_result(visit(std::dynamic_pointer_cast<CallNode>(node)->node_to_call, context));
-    if (res.error.is_error() != "None") return res;
+// The function a call runs: a copy of value positioned at the call
+static std::shared_ptr<Node> callee_of(std::shared_ptr<Node> node, std::shared_ptr<Node> value, Context* context) {
     std::shared_ptr<Node> value_to_call;
     if (value->get_class_name() == "Function") {
         value_to_call = std::make_shared<Function>(std::dynamic_pointer_cast<Function>(value)->copy());
@@ -3086,7 +4157,22 @@ RTResult Interpreter::visit_CallNode(std::shared_ptr<Node> node, Context* contex
     else if (value->get_class_name() == "BuiltInFunction") {
         value_to_call = std::make_shared<BuiltInFunction>(std::dynamic_pointer_cast<BuiltInFunction>(value)->copy());
         std::dynamic_pointer_cast<BuiltInFunction>(value_to_call)->set_pos(std::dynamic_pointer_cast<CallNode>(node)->pos_start, std::dynamic_pointer_cast<CallNode>(node)->pos_end);
+        // Builtins belong to no program, so they run in the instance of whoever calls them
+        std::dynamic_pointer_cast<BuiltInFunction>(value_to_call)->set_context(context);
     }
+    return value_to_call;
+}
+
+RTResult Interpreter::visit_CallNode(std::shared_ptr<Node> node, Context* context) {
+    std::cout << "Visiting CallNode" << std::endl;
+    //std::cout << "Context in CallNode: " << context->display_name << std::endl;
+    RTResult res = RTResult();
+
+    std::vector<std::shared_ptr<Node>> args;
+
+    std::shared_ptr<Node> value = res.register_result(visit(std::dynamic_pointer_cast<CallNode>(node)->node_to_call, context));
+    if (res.error.is_error() != "None") return res;
+    std::shared_ptr<Node> value_to_call = callee_of(node, value, context);
     
     for (auto x : std::dynamic_pointer_cast<CallNode>(node)->arg_nodes) {
         args.push_back(res.register_result(visit(x, context)));
@@ -3094,6 +4180,9 @@ RTResult Interpreter::visit_CallNode(std::shared_ptr<Node> node, Context* contex
     }
 
     std::shared_ptr<Node> return_value;
+    if (value_to_call->get_class_name() == "Function" && std::dynamic_pointer_cast<CallNode>(node)->is_tail_call) {
+        return res.success(std::make_shared<TailCall>(std::dynamic_pointer_cast<Function>(value_to_call), args));
+    }
     if (value_to_call->get_class_name() == "Function") {
         return_value = res.register_result(std::dynamic_pointer_cast<Function>(value_to_call)->execute_result(args));
         if (res.error.is_error() != "None") return res;
@@ -3102,75 +4191,640 @@ RTResult Interpreter::visit_CallNode(std::shared_ptr<Node> node, Context* contex
         return_value = res.register_result(std::dynamic_pointer_cast<BuiltInFunction>(value_to_call)->execute_result(args));
         if (res.error.is_error() != "None") return res;
     }
+    return finish_CallNode(node, return_value, context);
+}
+
+RTResult Interpreter::finish_CallNode(std::shared_ptr<Node> node, std::shared_ptr<Node> return_value, Context* context) {
+    if (return_value->get_class_name() == "Function") return RTResult().success(return_value);
+    return RTResult().success(positioned_copy(return_value, std::dynamic_pointer_cast<CallNode>(node)->pos_start, std::dynamic_pointer_cast<CallNode>(node)->pos_end, context));
+}
+
+static bool is_reusable(std::shared_ptr<Node> value) {
+    return value != nullptr && (value->get_class_name() == "Number" || value->get_class_name() == "String");
+}
+
+// The value a CachedNode kept from an earlier run, nullptr if it has to run
+static std::shared_ptr<Node> cached_value(std::shared_ptr<Node> node, Context* context) {
+    std::shared_ptr<CachedNode> cached = std::dynamic_pointer_cast<CachedNode>(node);
+    if (cached->mode == CachedNode::Mode::Define) return nullptr;
+    std::shared_ptr<Node> value = context->symbol_table->get_local(cached->slot_name);
+    if (value == nullptr) return nullptr;
+    return positioned_copy(value, cached->pos_start, cached->pos_end, context);
+}
+
+RTResult Interpreter::visit_CachedNode(std::shared_ptr<Node> node, Context* context) {
+    RTResult res = RTResult();
+    std::shared_ptr<Node> kept = cached_value(node, context);
+    if (kept != nullptr) return res.success(kept);
+
+    std::shared_ptr<Node> value = res.register_result(visit(std::dynamic_pointer_cast<CachedNode>(node)->expr_node, context));
+    if (res.error.is_error() != "None") return res;
+    return finish_CachedNode(node, value, context);
+}
+
+RTResult Interpreter::finish_CachedNode(std::shared_ptr<Node> node, std::shared_ptr<Node> value, Context* context) {
+    RTResult res = RTResult();
+    std::shared_ptr<CachedNode> cached = std::dynamic_pointer_cast<CachedNode>(node);
+    bool keep = is_reusable(value);
+    if (cached->mode == CachedNode::Mode::Invariant) {
+        // A list the inputs name could be changed through an alias by APPEND
+        // or friends before the next iteration
+        for (const std::string& input_name : cached->input_names) {
+            if (!is_reusable(context->symbol_table->get(input_name))) keep = false;
+        }
+        if (!keep) return res.success(value);
+    }
+    else if (cached->mode == CachedNode::Mode::Use) return res.success(value);
+
+    // A Define always writes so that a Use never sees a value from an earlier run
+    context->symbol_table->set(cached->slot_name, keep ? value : nullptr);
+    // The slot's value is shared from now on, whoever gets it gets a copy
+    return res.success(keep ? positioned_copy(value, cached->pos_start, cached->pos_end, context) : value);
+}
+
+////////////////////////////
+//////// EVALUATOR /////////
+////////////////////////////
+
+static ExecutionStats::NodeKind node_kind(const std::shared_ptr<Node>& node) {
+    std::string class_name = node->get_class_name();
+    if (class_name == "NumberNode") return ExecutionStats::NodeKind::NumberNode;
+    if (class_name == "StringNode") return ExecutionStats::NodeKind::StringNode;
+    if (class_name == "ListNode") return ExecutionStats::NodeKind::ListNode;
+    if (class_name == "VarAccessNode") return ExecutionStats::NodeKind::VarAccessNode;
+    if (class_name == "VarAssignNode") return ExecutionStats::NodeKind::VarAssignNode;
+    if (class_name == "BinOpNode") return ExecutionStats::NodeKind::BinOpNode;
+    if (class_name == "UnaryOpNode") return ExecutionStats::NodeKind::UnaryOpNode;
+    if (class_name == "IfNode") return ExecutionStats::NodeKind::IfNode;
+    if (class_name == "ForNode") return ExecutionStats::NodeKind::ForNode;
+    if (class_name == "WhileNode") return ExecutionStats::NodeKind::WhileNode;
+    if (class_name == "FuncDefNode") return ExecutionStats::NodeKind::FuncDefNode;
+    if (class_name == "CallNode") return ExecutionStats::NodeKind::CallNode;
+    if (class_name == "CachedNode") return ExecutionStats::NodeKind::CachedNode;
+    return ExecutionStats::NodeKind::count;
+}
+
+// Where an error about node as a whole points
+static std::pair<Position, Position> node_span(const std::shared_ptr<Node>& node) {
+    if (auto n = std::dynamic_pointer_cast<NumberNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<StringNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<ListNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<VarAccessNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<VarAssignNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<BinOpNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<UnaryOpNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<IfNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<ForNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<WhileNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<FuncDefNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<CallNode>(node)) return { n->pos_start, n->pos_end };
+    if (auto n = std::dynamic_pointer_cast<CachedNode>(node)) return { n->pos_start, n->pos_end };
+    return { Position::none(), Position::none() };
+}
+
+Evaluator::Evaluator(std::shared_ptr<Node> node, Context* context) {
+    push(node, context);
+}
+
+bool Evaluator::resume(uint64_t max_steps) {
+    for (uint64_t steps = 0; !tasks.empty() && steps < max_steps; steps++) step();
+    return tasks.empty();
+}
+
+RTResult Evaluator::run() {
+    resume();
+    return result;
+}
+
+void Evaluator::push(std::shared_ptr<Node> node, Context* context) {
+    size_t max_stack_depth = context->instance->limits.max_stack_depth;
+    if (max_stack_depth != 0 && tasks.size() >= max_stack_depth) {
+        std::pair<Position, Position> span = node_span(node);
+        return complete(RTResult().failure(RTError(span.first, span.second, "Maximum stack depth of " + std::to_string(max_stack_depth) + " exceeded", context)));
+    }
+
+    pending_operations++;
+    tasks.emplace_back();
+    Task& task = tasks.back();
+    task.node = node;
+    task.context = context;
+    task.kind = node_kind(node);
+    if (Profiler::is_active()) task.profile_scope = std::make_shared<ProfileScope>(node, context);
+    task.started = std::chrono::steady_clock::now();
+}
+
+void Evaluator::complete(RTResult res) {
+    do {
+        Task& task = tasks.back();
+        if (task.kind != ExecutionStats::NodeKind::count) {
+            ExecutionStats::record_visit(task.kind, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - task.started).count());
+        }
+        tasks.pop_back();
+    } while (res.error.is_error() != "None" && !tasks.empty());
+
+    if (tasks.empty()) result = res;
+    else received = res.value;
+}
+
+// Every case either pushes one child and returns, leaving the task to be
+// stepped again once the child's value is in received, or completes the task.
+// A push can reallocate tasks, so it always comes last.
+void Evaluator::step() {
+    Task& task = tasks.back();
+    std::shared_ptr<Node> node = task.node;
+    Context* context = task.context;
+
+    switch (task.kind) {
+    case ExecutionStats::NodeKind::NumberNode:
+        return complete(interpreter.visit_NumberNode(node, context));
+    case ExecutionStats::NodeKind::StringNode:
+        return complete(interpreter.visit_StringNode(node, context));
+    case ExecutionStats::NodeKind::VarAccessNode:
+        return complete(interpreter.visit_VarAccessNode(node, context));
+    case ExecutionStats::NodeKind::FuncDefNode:
+        return complete(interpreter.visit_FuncDefNode(node, context));
+
+    case ExecutionStats::NodeKind::ListNode: {
+        std::shared_ptr<ListNode> list_node = std::dynamic_pointer_cast<ListNode>(node);
+        if (task.step == 1) task.values.push_back(received);
+        if (task.values.size() == list_node->element_nodes.size()) return complete(interpreter.finish_ListNode(node, task.values, context));
+        task.step = 1;
+        return push(list_node->element_nodes[task.values.size()], context);
+    }
+
+    case ExecutionStats::NodeKind::VarAssignNode:
+        if (task.step == 1) return complete(interpreter.finish_VarAssignNode(node, received, context));
+        task.step = 1;
+        return push(std::dynamic_pointer_cast<VarAssignNode>(node)->value_node, context);
+
+    case ExecutionStats::NodeKind::UnaryOpNode:
+        if (task.step == 1) return complete(interpreter.finish_UnaryOpNode(node, received));
+        task.step = 1;
+        return push(std::dynamic_pointer_cast<UnaryOpNode>(node)->node, context);
+
+    case ExecutionStats::NodeKind::CachedNode: {
+        if (task.step == 1) return complete(interpreter.finish_CachedNode(node, received, context));
+        std::shared_ptr<Node> kept = cached_value(node, context);
+        if (kept != nullptr) return complete(RTResult().success(kept));
+        task.step = 1;
+        return push(std::dynamic_pointer_cast<CachedNode>(node)->expr_node, context);
+    }
+
+    case ExecutionStats::NodeKind::BinOpNode: {
+        std::shared_ptr<BinOpNode> bin_op = std::dynamic_pointer_cast<BinOpNode>(node);
+        if (task.step == 0) {
+            task.step = 1;
+            return push(bin_op->left_node, context);
+        }
+        if (task.step == 1) {
+            task.held = received;
+            task.quick_op = quick_op_after_left(bin_op, task.held);
+            std::shared_ptr<Node> decided = short_circuit(bin_op, task.held);
+            if (decided != nullptr) return complete(RTResult().success(decided));
+            task.step = 2;
+            return push(bin_op->right_node, context);
+        }
+        return complete(interpreter.finish_BinOpNode(node, task.quick_op, task.held, received, context));
+    }
+
+    case ExecutionStats::NodeKind::IfNode: {
+        std::shared_ptr<IfNode> if_node = std::dynamic_pointer_cast<IfNode>(node);
+        // The chosen branch's value is passed on as it is, a TailCall included
+        if (task.step == 2) return complete(RTResult().success(received));
+        if (task.step == 1) {
+            if (std::dynamic_pointer_cast<Number>(received)->is_true()) {
+                task.step = 2;
+                return push(if_node->cases[task.index][1], context);
+            }
+            task.index++;
+        }
+        if (task.index < if_node->cases.size()) {
+            task.step = 1;
+            return push(if_node->cases[task.index][0], context);
+        }
+        if (if_node->else_case != nullptr) {
+            task.step = 2;
+            return push(if_node->else_case, context);
+        }
+        return complete(RTResult().success(std::make_shared<Number>(Number(0, 1))));
+    }
+
+    case ExecutionStats::NodeKind::ForNode: {
+        std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+        switch (task.step) {
+        case 0:
+            task.step = 1;
+            return push(for_node->start_value_node, context);
+        case 1:
+            task.values.push_back(received);
+            task.step = 2;
+            return push(for_node->end_value_node, context);
+        case 2:
+            task.values.push_back(received);
+            task.step = 3;
+            if (for_node->step_value_node != nullptr) return push(for_node->step_value_node, context);
+            received = std::make_shared<Number>(Number(1));
+            return;
+        case 3: {
+            Error bounds_error = for_bounds(for_node, task.values[0], task.values[1], received, context, task.counter, task.end, task.increment);
+            if (bounds_error.is_error() != "None") return complete(RTResult().failure(bounds_error));
+            if (for_node->is_parallel) return complete(interpreter.visit_ParallelForNode(node, context, task.counter, task.end, task.increment));
+
+            for (const std::string& slot_name : for_node->cached_slots) context->symbol_table->set(slot_name, nullptr);
+            task.values.clear();
+            task.step = 4;
+            return;
+        }
+        case 4:
+            if (!(task.increment >= 0 ? task.counter < task.end : task.counter > task.end)) return complete(loop_result(node, task.values, context));
+            if (task.slot == nullptr) task.slot = context->symbol_table->slot(for_node->var_name_tok.text);
+            context->symbol_table->set_number(task.slot, task.counter);
+            task.counter += task.increment;
+            task.step = 5;
+            return push(for_node->body_node, context);
+        default: {
+            if (!for_node->is_void) task.values.push_back(received);
+            Error limit_error = end_of_iteration(node, context);
+            if (limit_error.is_error() != "None") return complete(RTResult().failure(limit_error));
+            task.step = 4;
+            return;
+        }
+        }
+    }
 
-    if (return_value->get_class_name() == "Number") {
-        std::dynamic_pointer_cast<Number>(return_value)->set_context(context);
-        std::dynamic_pointer_cast<Number>(return_value)->set_pos(std::dynamic_pointer_cast<CallNode>(node)->pos_start, std::dynamic_pointer_cast<CallNode>(node)->pos_end);
+    case ExecutionStats::NodeKind::WhileNode: {
+        std::shared_ptr<WhileNode> while_node = std::dynamic_pointer_cast<WhileNode>(node);
+        switch (task.step) {
+        case 0:
+            for (const std::string& slot_name : while_node->cached_slots) context->symbol_table->set(slot_name, nullptr);
+            task.step = 1;
+            return push(while_node->condition_node, context);
+        case 1:
+            if (!std::dynamic_pointer_cast<Number>(received)->is_true()) return complete(loop_result(node, task.values, context));
+            task.step = 2;
+            return push(while_node->body_node, context);
+        default: {
+            if (!while_node->is_void) task.values.push_back(received);
+            Error limit_error = end_of_iteration(node, context);
+            if (limit_error.is_error() != "None") return complete(RTResult().failure(limit_error));
+            task.step = 1;
+            return push(while_node->condition_node, context);
+        }
+        }
     }
-    else if (return_value->get_class_name() == "String") {
-        std::dynamic_pointer_cast<String>(return_value)->set_context(context);
-        std::dynamic_pointer_cast<String>(return_value)->set_pos(std::dynamic_pointer_cast<CallNode>(node)->pos_start, std::dynamic_pointer_cast<CallNode>(node)->pos_end);
+
+    case ExecutionStats::NodeKind::CallNode: {
+        std::shared_ptr<CallNode> call_node = std::dynamic_pointer_cast<CallNode>(node);
+        switch (task.step) {
+        case 0:
+            task.step = 1;
+            return push(call_node->node_to_call, context);
+        case 1:
+            task.held = callee_of(node, received, context);
+            task.step = 2;
+            if (!call_node->arg_nodes.empty()) return push(call_node->arg_nodes[0], context);
+            return;
+        case 2: {
+            if (task.values.size() < call_node->arg_nodes.size()) task.values.push_back(received);
+            if (task.values.size() < call_node->arg_nodes.size()) return push(call_node->arg_nodes[task.values.size()], context);
+
+            if (task.held->get_class_name() == "BuiltInFunction") {
+                RTResult res = RTResult();
+                std::shared_ptr<Node> return_value = res.register_result(std::dynamic_pointer_cast<BuiltInFunction>(task.held)->execute_result(task.values));
+                if (res.error.is_error() != "None") return complete(res);
+                return complete(interpreter.finish_CallNode(node, return_value, context));
+            }
+            task.function = std::dynamic_pointer_cast<Function>(task.held);
+            if (call_node->is_tail_call) return complete(RTResult().success(std::make_shared<TailCall>(task.function, task.values)));
+            task.frame = task.function->generate_new_context();
+            break;
+        }
+        default: {
+            // The body is done: its value, or a tail call to make in its place
+            std::shared_ptr<TailCall> tail_call = std::dynamic_pointer_cast<TailCall>(received);
+            task.trace_scope.reset();
+            if (tail_call == nullptr) {
+                keep_frame_of(received);
+                task.frame->instance->release_context(task.frame);
+                return complete(interpreter.finish_CallNode(node, received, context));
+            }
+            task.frame = task.function->frame_for_tail_call(tail_call->function.get(), task.frame);
+            task.function = tail_call->function;
+            task.values = tail_call->args;
+            break;
+        }
+        }
+
+        // What Function::execute_result does for each call it makes, with the
+        // body pushed instead of visited
+        task.trace_scope = std::make_shared<TraceScope>(task.function->name, task.function->pos_start);
+        RTResult entered = task.function->enter_frame(task.values, task.frame);
+        if (entered.error.is_error() != "None") return complete(entered);
+        task.step = 3;
+        return push(task.function->body_node, task.frame);
     }
-    else if (return_value->get_class_name() == "List") {
-        std::dynamic_pointer_cast<List>(return_value)->set_context(context);
-        std::dynamic_pointer_cast<List>(return_value)->set_pos(std::dynamic_pointer_cast<CallNode>(node)->pos_start, std::dynamic_pointer_cast<CallNode>(node)->pos_end);
+
+    default:
+        return complete(interpreter.no_visit_method(node, context));
     }
-    return res.success(return_value);
 }
 
 ////////////////////////////
 /////////// RUN ////////////
 ////////////////////////////
 
-Number Number::null_ = Number(0);
-Number Number::false_ = Number(0);
-Number Number::true_ = Number(1);
-Number Number::math_PI_ = Number(3.14159265358979323846);
-
-std::vector<std::string> BuiltInFunction::execute_print_arg_names_{ "value" };
-std::vector<std::string> BuiltInFunction::execute_print_ret_arg_names_{ "value" };
-std::vector<std::string> BuiltInFunction::execute_input_arg_names_{};
-std::vector<std::string> BuiltInFunction::execute_input_int_arg_names_{};
-std::vector<std::string> BuiltInFunction::execute_clear_arg_names_{};
-std::vector<std::string> BuiltInFunction::execute_is_number_arg_names_{ "value" };
-std::vector<std::string> BuiltInFunction::execute_is_string_arg_names_{ "value" };
-std::vector<std::string> BuiltInFunction::execute_is_list_arg_names_{ "value" };
-std::vector<std::string> BuiltInFunction::execute_is_function_arg_names_{ "value" };
-std::vector<std::string> BuiltInFunction::execute_append_arg_names_{ "list", "value" };
-std::vector<std::string> BuiltInFunction::execute_pop_arg_names_{ "list", "index" };
-std::vector<std::string> BuiltInFunction::execute_extend_arg_names_{ "listA", "listB" };
-
-BuiltInFunction BuiltInFunction::BuiltInFunction_print = BuiltInFunction("print");
-BuiltInFunction BuiltInFunction::BuiltInFunction_print_ret = BuiltInFunction("print_ret");
-BuiltInFunction BuiltInFunction::BuiltInFunction_input = BuiltInFunction("input");
-BuiltInFunction BuiltInFunction::BuiltInFunction_input_int = BuiltInFunction("input_int");
-BuiltInFunction BuiltInFunction::BuiltInFunction_clear = BuiltInFunction("clear");
-BuiltInFunction BuiltInFunction::BuiltInFunction_is_number = BuiltInFunction("is_number");
-BuiltInFunction BuiltInFunction::BuiltInFunction_is_string = BuiltInFunction("is_string");
-BuiltInFunction BuiltInFunction::BuiltInFunction_is_list = BuiltInFunction("is_list");
-BuiltInFunction BuiltInFunction::BuiltInFunction_is_function = BuiltInFunction("is_function");
-BuiltInFunction BuiltInFunction::BuiltInFunction_append = BuiltInFunction("append");
-BuiltInFunction BuiltInFunction::BuiltInFunction_pop = BuiltInFunction("pop");
-BuiltInFunction BuiltInFunction::BuiltInFunction_extend = BuiltInFunction("extend");
-
-std::pair<std::shared_ptr<Node>, Error> run(std::string fn, std::string text) {
-    global_symbol_table.set("NULL", std::make_shared<Number>(Number::null_));
-    global_symbol_table.set("TRUE", std::make_shared<Number>(Number::true_));
-    global_symbol_table.set("FALSE", std::make_shared<Number>(Number::false_));
-    global_symbol_table.set("MATH_PI", std::make_shared<Number>(Number::math_PI_));
-    global_symbol_table.set("PRINT", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_print));
-    global_symbol_table.set("PRINT_RET", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_print_ret));
-    global_symbol_table.set("INPUT", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_input));
-    global_symbol_table.set("INPUT_INT", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_input_int));
-    global_symbol_table.set("CLEAR", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_clear));
-    global_symbol_table.set("CLS", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_clear));
-    global_symbol_table.set("IS_NUM", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_is_number));
-    global_symbol_table.set("IS_STR", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_is_string));
-    global_symbol_table.set("IS_LIST", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_is_list));
-    global_symbol_table.set("IS_FUN", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_is_function));
-    global_symbol_table.set("APPEND", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_append));
-    global_symbol_table.set("POP", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_pop));
-    global_symbol_table.set("EXTEND", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_extend));
+const Number Number::null_ = Number(0);
+const Number Number::false_ = Number(0);
+const Number Number::true_ = Number(1);
+const Number Number::math_PI_ = Number(3.14159265358979323846);
+
+const std::vector<std::string> BuiltInFunction::execute_print_arg_names_{ "value" };
+const std::vector<std::string> BuiltInFunction::execute_print_ret_arg_names_{ "value" };
+const std::vector<std::string> BuiltInFunction::execute_input_arg_names_{};
+const std::vector<std::string> BuiltInFunction::execute_input_int_arg_names_{};
+const std::vector<std::string> BuiltInFunction::execute_clear_arg_names_{};
+const std::vector<std::string> BuiltInFunction::execute_flush_arg_names_{};
+const std::vector<std::string> BuiltInFunction::execute_is_number_arg_names_{ "value" };
+const std::vector<std::string> BuiltInFunction::execute_is_string_arg_names_{ "value" };
+const std::vector<std::string> BuiltInFunction::execute_is_list_arg_names_{ "value" };
+const std::vector<std::string> BuiltInFunction::execute_is_function_arg_names_{ "value" };
+const std::vector<std::string> BuiltInFunction::execute_append_arg_names_{ "list", "value" };
+const std::vector<std::string> BuiltInFunction::execute_pop_arg_names_{ "list", "index" };
+const std::vector<std::string> BuiltInFunction::execute_extend_arg_names_{ "listA", "listB" };
+const std::vector<std::string> BuiltInFunction::execute_parallel_map_arg_names_{ "list", "function" };
+const std::vector<std::string> BuiltInFunction::execute_parallel_reduce_arg_names_{ "list", "function", "initial" };
+const std::vector<std::string> BuiltInFunction::execute_reduce_arg_names_{ "list", "function", "initial" };
+const std::vector<std::string> BuiltInFunction::execute_spawn_arg_names_{ "function" };
+const std::vector<std::string> BuiltInFunction::execute_await_arg_names_{ "future" };
+const std::vector<std::string> BuiltInFunction::execute_channel_arg_names_{ "capacity" };
+const std::vector<std::string> BuiltInFunction::execute_send_arg_names_{ "channel", "value" };
+const std::vector<std::string> BuiltInFunction::execute_recv_arg_names_{ "channel" };
+const std::vector<std::string> BuiltInFunction::execute_close_arg_names_{ "channel" };
+const std::vector<std::string> BuiltInFunction::execute_stats_arg_names_{};
+
+const BuiltInFunction BuiltInFunction::BuiltInFunction_print = BuiltInFunction("print");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_print_ret = BuiltInFunction("print_ret");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_input = BuiltInFunction("input");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_input_int = BuiltInFunction("input_int");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_clear = BuiltInFunction("clear");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_flush = BuiltInFunction("flush");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_is_number = BuiltInFunction("is_number");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_is_string = BuiltInFunction("is_string");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_is_list = BuiltInFunction("is_list");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_is_function = BuiltInFunction("is_function");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_append = BuiltInFunction("append");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_pop = BuiltInFunction("pop");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_extend = BuiltInFunction("extend");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_parallel_map = BuiltInFunction("parallel_map");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_parallel_reduce = BuiltInFunction("parallel_reduce");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_reduce = BuiltInFunction("reduce");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_spawn = BuiltInFunction("spawn");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_await = BuiltInFunction("await");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_channel = BuiltInFunction("channel");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_send = BuiltInFunction("send");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_recv = BuiltInFunction("recv");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_close = BuiltInFunction("close");
+const BuiltInFunction BuiltInFunction::BuiltInFunction_stats = BuiltInFunction("stats");
+
+////////////////////////////
+/// INTERPRETER INSTANCE ///
+////////////////////////////
+
+InterpreterInstance::InterpreterInstance(int output_fd)
+    : output(output_fd), values_created(0), root("<program>"), operations(0), allocated_bytes(0) {
+    root.symbol_table = &globals;
+    root.instance = this;
+    add_builtins();
+}
+
+void InterpreterInstance::add_builtins() {
+    globals.set("NULL", std::make_shared<Number>(Number::null_));
+    globals.set("TRUE", std::make_shared<Number>(Number::true_));
+    globals.set("FALSE", std::make_shared<Number>(Number::false_));
+    globals.set("MATH_PI", std::make_shared<Number>(Number::math_PI_));
+    globals.set("PRINT", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_print));
+    globals.set("PRINT_RET", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_print_ret));
+    globals.set("INPUT", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_input));
+    globals.set("INPUT_INT", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_input_int));
+    globals.set("CLEAR", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_clear));
+    globals.set("CLS", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_clear));
+    globals.set("FLUSH", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_flush));
+    globals.set("IS_NUM", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_is_number));
+    globals.set("IS_STR", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_is_string));
+    globals.set("IS_LIST", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_is_list));
+    globals.set("IS_FUN", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_is_function));
+    globals.set("APPEND", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_append));
+    globals.set("POP", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_pop));
+    globals.set("EXTEND", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_extend));
+    globals.set("PARALLEL_MAP", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_parallel_map));
+    globals.set("PARALLEL_REDUCE", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_parallel_reduce));
+    globals.set("REDUCE", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_reduce));
+    globals.set("SPAWN", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_spawn));
+    globals.set("AWAIT", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_await));
+    globals.set("CHANNEL", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_channel));
+    globals.set("SEND", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_send));
+    globals.set("RECV", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_recv));
+    globals.set("CLOSE", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_close));
+    globals.set("STATS", std::make_shared<BuiltInFunction>(BuiltInFunction::BuiltInFunction_stats));
+}
+
+Context* InterpreterInstance::new_context(std::string display_name, Context* parent, Position parent_entry_pos) {
+    std::lock_guard<std::mutex> lock(arena_mutex);
+    frames_created++;
+    if (!free_contexts.empty()) {
+        Context* reused = free_contexts.back();
+        free_contexts.pop_back();
+        reused->display_name = display_name;
+        reused->parent = parent;
+        reused->parent_entry_pos = parent_entry_pos;
+        reused->depth = parent != nullptr ? parent->depth + 1 : 0;
+        reused->symbol_table->parent = parent != nullptr ? parent->symbol_table : nullptr;
+        return reused;
+    }
+
+    contexts.emplace_back(display_name, parent, parent_entry_pos);
+    Context* new_context = &contexts.back();
+    new_context->instance = this;
+    symbol_tables.emplace_back(parent != nullptr ? parent->symbol_table : nullptr);
+    new_context->symbol_table = &symbol_tables.back();
+    charge_bytes(sizeof(Context) + sizeof(SymbolTable));
+    return new_context;
+}
+
+// Frames are only ever released after a successful return: an error keeps
+// every frame it passed through for its traceback. Samples of a running
+// profiler point at frames until it stops, so then nothing is reused.
+void InterpreterInstance::release_context(Context* context) {
+    if (context->captured.load(std::memory_order_relaxed) || Profiler::is_active()) return;
+    context->symbol_table->clear();
+    std::lock_guard<std::mutex> lock(arena_mutex);
+    free_contexts.push_back(context);
+}
+
+// Forgets every variable and call frame of the programs run so far, leaving
+// the instance as it was when constructed.
+void InterpreterInstance::reset() {
+    output.flush();
+    std::lock_guard<std::mutex> lock(arena_mutex);
+    globals.symbols.clear();
+    free_contexts.clear();
+    contexts.clear();
+    symbol_tables.clear();
+    add_builtins();
+}
+
+RTResult InterpreterInstance::execute(std::shared_ptr<Node> ast) {
+    operations = 0;
+    allocated_bytes = 0;
+    deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(limits.max_seconds));
+    values_created = 0;
+    size_t frames_before = frames_created;
+    PhaseTimer run_timer;
+
+    std::cout<<"Pk - Main context: "<<root.display_name<<std::endl;
+    RTResult result_runtime;
+    {
+        ValueCountScope counting(values_created);
+        OperationCountScope operation_count(this);
+        result_runtime = evaluate(ast, &root);
+    }
+    if (!wait_for_tasks() && result_runtime.error.is_error() == "None") {
+        // Points at the last statement, where the program waited for its tasks
+        std::shared_ptr<ListNode> program = std::dynamic_pointer_cast<ListNode>(ast);
+        std::pair<Position, Position> span = node_span(program && !program->element_nodes.empty() ? program->element_nodes.back() : ast);
+        result_runtime = RTResult().failure(time_limit_error(span.first, span.second, &root));
+    }
+    output.flush();
+
+    // Only the run phase, lexing and parsing are filled in by run()
+    summary = RunSummary();
+    summary.run_wall_ms = run_timer.wall_ms();
+    summary.run_cpu_ms = run_timer.cpu_ms();
+    summary.operations = operations.load();
+    summary.values_created = values_created.load();
+    summary.allocated_bytes = allocated_bytes.load();
+    summary.frames = frames_created - frames_before;
+    summary.peak_rss_kb = ::peak_rss_kb();
+    return result_runtime;
+}
+
+// Called at loop back-edges and call sites. Once a limit is exceeded every
+// later check fails as well, so PARFOR workers and SPAWNed tasks of the same
+// run stop at their next back-edge or call.
+Error InterpreterInstance::check_limits(Position pos_start, Position pos_end, Context* context) {
+    uint64_t operations_so_far = operations.fetch_add(pending_operations, std::memory_order_relaxed) + pending_operations;
+    pending_operations = 0;
+
+    if (limits.max_operations != 0 && operations_so_far > limits.max_operations) {
+        return RTError(pos_start, pos_end, "Operation limit of " + std::to_string(limits.max_operations) + " exceeded", context);
+    }
+    if (limits.max_call_depth != 0 && context->depth > limits.max_call_depth) {
+        return RTError(pos_start, pos_end, "Maximum call depth of " + std::to_string(limits.max_call_depth) + " exceeded", context);
+    }
+    if (limits.max_bytes != 0 && allocated_bytes.load(std::memory_order_relaxed) > limits.max_bytes) {
+        return memory_limit_error(pos_start, pos_end, context);
+    }
+    if (limits.max_seconds != 0 && std::chrono::steady_clock::now() > deadline) {
+        return time_limit_error(pos_start, pos_end, context);
+    }
+    return Error();
+}
+
+std::chrono::steady_clock::time_point InterpreterInstance::wait_deadline() const {
+    if (limits.max_seconds == 0) return std::chrono::steady_clock::time_point::max();
+    return deadline;
+}
+
+Error InterpreterInstance::time_limit_error(Position pos_start, Position pos_end, Context* context) const {
+    std::ostringstream seconds;
+    seconds << limits.max_seconds;
+    return RTError(pos_start, pos_end, "Time limit of " + seconds.str() + " seconds exceeded", context);
+}
+
+void InterpreterInstance::flush_operations() {
+    operations.fetch_add(pending_operations, std::memory_order_relaxed);
+    pending_operations = 0;
+}
+
+void InterpreterInstance::charge_bytes(size_t bytes) {
+    allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+size_t InterpreterInstance::bytes_left() const {
+    if (limits.max_bytes == 0) return SIZE_MAX;
+    size_t allocated = allocated_bytes.load(std::memory_order_relaxed);
+    return allocated >= limits.max_bytes ? 0 : limits.max_bytes - allocated;
+}
+
+Error InterpreterInstance::memory_limit_error(Position pos_start, Position pos_end, Context* context) const {
+    return RTError(pos_start, pos_end, "Memory limit of " + std::to_string(limits.max_bytes) + " bytes exceeded", context);
+}
+
+void InterpreterInstance::task_started() {
+    std::lock_guard<std::mutex> lock(tasks_mutex);
+    running_tasks++;
+}
+
+void InterpreterInstance::task_finished() {
+    std::lock_guard<std::mutex> lock(tasks_mutex);
+    if (--running_tasks == 0) tasks_done.notify_all();
+}
+
+// Tasks still SPAWNed at the end of a program keep running until they are
+// done, whether or not anyone AWAITs them. Returns false if the time limit
+// ran out first. Tasks still running then fail at their next limit check or
+// blocking wait, and are only waited for while they unwind, since they use
+// the instance's frames.
+bool InterpreterInstance::wait_for_tasks() {
+    std::unique_lock<std::mutex> lock(tasks_mutex);
+    bool finished = wait_until_deadline(tasks_done, lock, wait_deadline(), [this] { return running_tasks == 0; });
+    if (!finished) tasks_done.wait(lock, [this] { return running_tasks == 0; });
+    return finished;
+}
+
+// Every node of a parsed program, for RunSummary
+static size_t count_nodes(std::shared_ptr<Node> node) {
+    if (node == nullptr) return 0;
+    std::string class_name = node->get_class_name();
+    std::vector<std::shared_ptr<Node>> children;
+
+    if (class_name == "BinOpNode") {
+        children = { std::dynamic_pointer_cast<BinOpNode>(node)->left_node, std::dynamic_pointer_cast<BinOpNode>(node)->right_node };
+    }
+    else if (class_name == "UnaryOpNode") {
+        children = { std::dynamic_pointer_cast<UnaryOpNode>(node)->node };
+    }
+    else if (class_name == "VarAssignNode") {
+        children = { std::dynamic_pointer_cast<VarAssignNode>(node)->value_node };
+    }
+    else if (class_name == "ListNode") {
+        children = std::dynamic_pointer_cast<ListNode>(node)->element_nodes;
+    }
+    else if (class_name == "IfNode") {
+        for (auto case_ : std::dynamic_pointer_cast<IfNode>(node)->cases) children.insert(children.end(), case_.begin(), case_.end());
+        children.push_back(std::dynamic_pointer_cast<IfNode>(node)->else_case);
+    }
+    else if (class_name == "ForNode") {
+        std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+        children = { for_node->start_value_node, for_node->end_value_node, for_node->step_value_node, for_node->body_node };
+    }
+    else if (class_name == "WhileNode") {
+        children = { std::dynamic_pointer_cast<WhileNode>(node)->condition_node, std::dynamic_pointer_cast<WhileNode>(node)->body_node };
+    }
+    else if (class_name == "FuncDefNode") {
+        children = { std::dynamic_pointer_cast<FuncDefNode>(node)->body_node };
+    }
+    else if (class_name == "CallNode") {
+        children = std::dynamic_pointer_cast<CallNode>(node)->arg_nodes;
+        children.push_back(std::dynamic_pointer_cast<CallNode>(node)->node_to_call);
+    }
+
+    size_t count = 1;
+    for (auto child : children) count += count_nodes(child);
+    return count;
+}
+
+std::pair<std::shared_ptr<Node>, Error> parse_program(std::string fn, std::string_view text, RunSummary* summary, SymbolTable* globals) {
     // Debug: Starting the run function
     //std::cout << "Starting run function with fn: " << fn << " and text: " << text << std::endl;
 
@@ -3178,7 +4832,13 @@ std::pair<std::shared_ptr<Node>, Error> run(std::string fn, std::string text) {
     Lexer lexer(fn, text);
     //std::cout << "Lexer initialized." << std::endl;
 
+    PhaseTimer lex_timer;
     std::pair<std::vector<Token>, Error> result = lexer.make_tokens();
+    if (summary != nullptr) {
+        summary->lex_wall_ms = lex_timer.wall_ms();
+        summary->lex_cpu_ms = lex_timer.cpu_ms();
+        summary->tokens = result.first.size();
+    }
     //std::cout << "Tokens generated." << std::endl;
 
     std::vector<Token> tokens = result.first;
@@ -3201,13 +4861,25 @@ std::pair<std::shared_ptr<Node>, Error> run(std::string fn, std::string text) {
     // Generate AST
     Parser parser(tokens);
 
+    PhaseTimer parse_timer;
     std::shared_ptr<Node> ast = parser.parse();
+    if (summary != nullptr) {
+        summary->parse_wall_ms = parse_timer.wall_ms();
+        summary->parse_cpu_ms = parse_timer.cpu_ms();
+        summary->ast_nodes = count_nodes(std::dynamic_pointer_cast<ParseResult>(ast)->node);
+    }
     std::cout << "AST generated." << std::endl;
 
     if(std::dynamic_pointer_cast<ParseResult>(ast)->error.is_error() != "None") return std::make_pair(temp, std::dynamic_pointer_cast<ParseResult>(ast)->error);
 
     // Assuming std::dynamic_pointer_cast<ParseResult> is valid and has node and error members
     auto parseResult = std::dynamic_pointer_cast<ParseResult>(ast);
+    parseResult->node = fold_constants(parseResult->node, globals);
+    hoist_invariants(parseResult->node);
+    eliminate_common_subexpressions(parseResult->node);
+    mark_void_context(parseResult->node);
+    infer_types(parseResult->node);
+    mark_tail_calls(parseResult->node);
    /* if (parseResult) {
         std::cout << "ParseResult node and error extracted." << std::endl;
     }
@@ -3218,22 +4890,26 @@ std::pair<std::shared_ptr<Node>, Error> run(std::string fn, std::string text) {
     // Print AST
     std::cout << "Abstract tree is: " << *(parseResult->node) << std::endl;
 
+    return std::make_pair(parseResult->node, parseResult->error);
+}
+
+std::pair<std::shared_ptr<Node>, Error> InterpreterInstance::run(std::string fn, std::string_view text) {
+    RunSummary parse_summary;
+    std::pair<std::shared_ptr<Node>, Error> parsed = parse_program(fn, text, &parse_summary, &globals);
+    summary = parse_summary;
+    std::shared_ptr<Node> temp;
+    if (parsed.second.is_error() != "None") return std::make_pair(temp, parsed.second);
+
     // Run program
-    Interpreter interpreter = Interpreter();
-    Context contextObj("<program>");
-    Context* context = &contextObj;
-    context->symbol_table = &global_symbol_table;
-    std::cout<<"Pk - Main context: "<<context->display_name<<std::endl;
-    RTResult result_runtime = interpreter.visit(std::dynamic_pointer_cast<ParseResult>(ast)->node, context);
+    RTResult result_runtime = execute(parsed.first);
+    summary.set_parse_phases(parse_summary);
 
     std::shared_ptr<Node> resultNumber = result_runtime.value;
 
     //std::cout<< "Final context: "<< result_runtime.error.context->display_name << std::endl;
 
     if(result_runtime.error.is_error() != "None") {
-        std::cout << "hi\n";
-        std::cout << result_runtime.error.as_string() << std::endl;
-        return std::make_pair(temp, Error());
+        return std::make_pair(temp, result_runtime.error);
     }
 
     if(resultNumber->get_class_name()=="Number"){
@@ -3259,5 +4935,14 @@ std::pair<std::shared_ptr<Node>, Error> run(std::string fn, std::string text) {
     }*/
     //std::cout << "haha\n";
 
-    return std::make_pair(parseResult->node, parseResult->error);
+    return parsed;
+}
+
+InterpreterInstance& default_interpreter() {
+    static InterpreterInstance instance;
+    return instance;
+}
+
+std::pair<std::shared_ptr<Node>, Error> run(std::string fn, std::string_view text) {
+    return default_interpreter().run(fn, text);
 }
\ No newline at end of file
@@ -4,11 +4,21 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <algorithm>
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "output_sink.h"
+#include "stats.h"
 
 
 extern std::string DIGITS;
@@ -71,6 +81,7 @@ class BuiltInFunction;
 class RTResult;
 class SymbolTable;
 class Interpreter;
+class InterpreterInstance;
 
 
 // Node
@@ -91,8 +102,8 @@ class Position
 {
 public:    
     Position();
-    Position(int idx, int ln, int col, std::string fn, std::string ftxt);
-    Position advance(char current_char = '\0');
+    Position(int idx, int ln, int col, std::string fn, std::string_view ftxt);
+    Position& advance(char current_char = '\0');
     Position copy();
 
     static Position none() {
@@ -103,7 +114,8 @@ public:
     bool operator!=(const Position& other) const;
 
     int idx, ln, col;
-    std::string fn, ftxt;
+    std::string fn;
+    std::string_view ftxt; // view into the source text, which must outlive every Position
 };
 
 //Context
@@ -117,6 +129,16 @@ public:
     Context* parent;
     SymbolTable* symbol_table; 
     Position parent_entry_pos;
+    InterpreterInstance* instance; // inherited from the parent
+    size_t depth; // number of frames above this one
+    // Set once something that can outlive the call refers to the frame: a
+    // list made in it, a function read in it that is then stored, passed or
+    // returned, or a builtin called from it that keeps its arguments or
+    // starts work. A captured frame is never released, and neither are the
+    // frames above it.
+    std::atomic<bool> captured{ false };
+
+    void capture();
 };
 
 // Errors
@@ -178,7 +200,7 @@ public:
 // Lexer
 class Lexer {
 public:
-    Lexer(std::string fn, std::string text);
+    Lexer(std::string fn, std::string_view text);
     std::pair<std::vector<Token>, Error> make_tokens();
     void advance();
     Token make_number();
@@ -191,7 +213,8 @@ public:
     Token make_greater_than();
 
 private:   
-    std::string fn, text;
+    std::string fn;
+    std::string_view text;
     Position pos;
     char current_char;
 };
@@ -238,6 +261,7 @@ public:
 
     std::vector<std::shared_ptr<Node>> element_nodes;
     Position pos_start, pos_end;
+    bool is_block = false; // statements, not a list literal
 };
 
 class VarAccessNode : public Node
@@ -269,6 +293,10 @@ public:
 
 
 
+// The operators a BinOpNode can apply, indexing the kernel tables in
+// kernels.h; count for a token that is none of them
+enum class Opcode : uint8_t { Add, Sub, Mul, Div, Pow, Eq, Ne, Lt, Gt, Lte, Gte, And, Or, count };
+
 class BinOpNode : public Node
 {
 public:    
@@ -279,10 +307,18 @@ public:
 
     friend std::ostream& operator<<(std::ostream& os, const BinOpNode& obj);
 
+    // Handler visit_BinOpNode installs once it has seen the node's operands:
+    // the opcode's Number kernel when both were Numbers, Generic otherwise or
+    // after an operand of another type turns up
+    enum class QuickOp : uint8_t { Unresolved, Numbers, Generic };
+
     std::shared_ptr<Node> left_node;
     Token op_tok;
     std::shared_ptr<Node> right_node;
     Position pos_start, pos_end;
+    Opcode opcode = Opcode::count; // from op_tok
+    std::atomic<QuickOp> quick_op{ QuickOp::Unresolved }; // shared by every thread running the node
+    bool numeric_operands = false; // both proven Numbers by infer_types, so never checked
 };
 
 class UnaryOpNode : public Node
@@ -316,7 +352,7 @@ public:
 class ForNode : public Node
 {
 public:
-    ForNode(Token var_name_tok, std::shared_ptr<Node> start_value_node, std::shared_ptr<Node> end_value_node, std::shared_ptr<Node> step_value_node, std::shared_ptr<Node> body_node);
+    ForNode(Token var_name_tok, std::shared_ptr<Node> start_value_node, std::shared_ptr<Node> end_value_node, std::shared_ptr<Node> step_value_node, std::shared_ptr<Node> body_node, bool is_parallel = false);
     void print(std::ostream& os) const override; // Override print method
     std::string get_class_name() const override;
 
@@ -325,6 +361,9 @@ public:
     Token var_name_tok;
     Position pos_start, pos_end;
     std::shared_ptr<Node> start_value_node, end_value_node, step_value_node, body_node;
+    bool is_parallel; // PARFOR
+    bool is_void = false; // value never used, see mark_void_context
+    std::vector<std::string> cached_slots; // cleared on entry, see hoist_invariants
 };
 
 class WhileNode : public Node
@@ -338,6 +377,8 @@ public:
 
     Position pos_start, pos_end;
     std::shared_ptr<Node> condition_node, body_node;
+    bool is_void = false; // value never used, see mark_void_context
+    std::vector<std::string> cached_slots; // cleared on entry, see hoist_invariants
 };
 
 class FuncDefNode : public Node
@@ -368,6 +409,31 @@ public:
     std::shared_ptr<Node> node_to_call;
     std::vector<std::shared_ptr<Node>> arg_nodes;
     Position pos_start, pos_end;
+    bool is_tail_call = false; // set by mark_tail_calls
+};
+
+// A side-effect free expression whose value can be reused, put in place by
+// hoist_invariants and eliminate_common_subexpressions. The value is kept in
+// the evaluating context's symbol table under slot_name, which no program
+// can spell.
+//   Invariant  reuse the value the slot holds, which the loop clears on entry
+//   Define     evaluate and fill the slot
+//   Use        reuse the value a Define earlier in the statement left
+// Only Numbers and Strings are reused; anything else is evaluated each time.
+class CachedNode : public Node
+{
+public:
+    enum class Mode { Invariant, Define, Use };
+
+    CachedNode(std::shared_ptr<Node> expr_node, std::string slot_name, Mode mode, Position pos_start, Position pos_end);
+    void print(std::ostream& os) const override; // Override print method
+    std::string get_class_name() const override;
+
+    std::shared_ptr<Node> expr_node;
+    std::string slot_name;
+    Mode mode;
+    std::vector<std::string> input_names; // variables expr_node reads
+    Position pos_start, pos_end;
 };
 
 // Parse Result
@@ -421,13 +487,25 @@ public:
     std::shared_ptr<Node> bin_op(std::function<std::shared_ptr<Node>()> func_a, std::vector<std::string> ops, std::function<std::shared_ptr<Node>()> func_b=nullptr);
 
 private:
+    // Fails the parse once it passes max_nesting or max_depth, see basic.cpp
+    std::shared_ptr<Node> nested_too_deeply();
+
     std::vector<Token> tokens;
     Token current_tok;
     int tok_idx;
+    int nesting = 0; // calls of expr and factor in progress
+    int depth = 0;   // depth of the AST below them, operator chains included
+    Error nesting_error; // reported by parse() whatever the rules above made of it
 };
 
 
 // Values
+
+// Shortest text that reads back as the same double (std::to_chars), the
+// returned view points into the caller's buffer
+std::string_view format_number(double value, char (&buffer)[32]);
+void append_number(std::string& out, double value);
+
 class Number : public Node
 {
 public:
@@ -463,10 +541,10 @@ public:
     Context* context;
     bool is_none;
 
-    static Number null_;
-    static Number false_;
-    static Number true_;
-    static Number math_PI_;
+    static const Number null_;
+    static const Number false_;
+    static const Number true_;
+    static const Number math_PI_;
 };
 
 class String : public Node {
@@ -512,6 +590,64 @@ public:
     Position pos_start, pos_end;
 };
 
+// Result of a SPAWNed call, filled in by the task once it finishes
+class Future : public Node
+{
+public:
+    Future();
+    Future set_pos(Position pos_start = Position::none(), Position pos_end = Position::none());
+    Future set_context(Context* context = nullptr);
+    void resolve(std::shared_ptr<Node> value, Error error);
+    // Returns false if the deadline passes first, see InterpreterInstance::wait_deadline
+    bool wait(std::chrono::steady_clock::time_point deadline);
+
+    void print(std::ostream& os) const override; // Override print method
+    std::string get_class_name() const override;
+
+    struct State
+    {
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool done = false;
+        std::shared_ptr<Node> value;
+        Error error;
+    };
+
+    std::shared_ptr<State> state; // shared by every copy of the future
+    Position pos_start, pos_end;
+    Context* context;
+};
+
+// Bounded queue between tasks, see CHANNEL, SEND, RECV and CLOSE
+class Channel : public Node
+{
+public:
+    Channel(size_t capacity);
+    Channel set_pos(Position pos_start = Position::none(), Position pos_end = Position::none());
+    Channel set_context(Context* context = nullptr);
+    enum class Result { Done, Closed, TimedOut };
+
+    Result send(std::shared_ptr<Node> value, std::chrono::steady_clock::time_point deadline);
+    Result receive(std::chrono::steady_clock::time_point deadline, std::shared_ptr<Node>& value);
+    void close();
+
+    void print(std::ostream& os) const override; // Override print method
+    std::string get_class_name() const override;
+
+    struct State
+    {
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::deque<std::shared_ptr<Node>> items;
+        size_t capacity = 1;
+        bool closed = false;
+    };
+
+    std::shared_ptr<State> state; // shared by every copy of the channel
+    Position pos_start, pos_end;
+    Context* context;
+};
+
 class BaseFunction : public Node
 {
 public:
@@ -540,6 +676,10 @@ public:
     Function(std::string name, std::shared_ptr<Node> body_node, std::vector<std::string> arg_names);   
     Function copy();
     RTResult execute_result(std::vector<std::shared_ptr<Node>> args);
+    // Checks the limits and binds the arguments in a frame for this function
+    RTResult enter_frame(std::vector<std::shared_ptr<Node>> args, Context* exec_ctx);
+    // The frame a tail call from a frame of this function runs in
+    Context* frame_for_tail_call(Function* callee, Context* exec_ctx);
 
     friend std::ostream& operator<<(std::ostream& os, const Function& obj);
 
@@ -550,6 +690,22 @@ public:
     std::vector<std::string> arg_names;
 };
 
+// What visit_CallNode returns for a call marked by mark_tail_calls to a
+// user function: the call, not yet made. The Function::execute_result whose
+// body produced it makes the call in its own loop, as Evaluator does in the
+// task of the call, so it never reaches code outside a function body.
+class TailCall : public Node
+{
+public:
+    TailCall(std::shared_ptr<Function> function, std::vector<std::shared_ptr<Node>> args);
+
+    void print(std::ostream& os) const override; // Override print method
+    std::string get_class_name() const override;
+
+    std::shared_ptr<Function> function;
+    std::vector<std::shared_ptr<Node>> args;
+};
+
 class BuiltInFunction : public BaseFunction
 {
 public:
@@ -561,6 +717,7 @@ public:
     RTResult execute_input(Context* exec_ctx);
     RTResult execute_input_int(Context* exec_ctx);
     RTResult execute_clear(Context* exec_ctx);
+    RTResult execute_flush(Context* exec_ctx);
     RTResult execute_is_number(Context* exec_ctx);
     RTResult execute_is_string(Context* exec_ctx);
     RTResult execute_is_list(Context* exec_ctx);
@@ -568,6 +725,16 @@ public:
     RTResult execute_append(Context* exec_ctx);
     RTResult execute_pop(Context* exec_ctx);
     RTResult execute_extend(Context* exec_ctx);
+    RTResult execute_parallel_map(Context* exec_ctx);
+    RTResult execute_parallel_reduce(Context* exec_ctx);
+    RTResult execute_reduce(Context* exec_ctx);
+    RTResult execute_spawn(Context* exec_ctx, std::vector<std::shared_ptr<Node>> args);
+    RTResult execute_await(Context* exec_ctx);
+    RTResult execute_channel(Context* exec_ctx);
+    RTResult execute_send(Context* exec_ctx);
+    RTResult execute_recv(Context* exec_ctx);
+    RTResult execute_close(Context* exec_ctx);
+    RTResult execute_stats(Context* exec_ctx);
     RTResult no_visit_method(Context* context);
 
     friend std::ostream& operator<<(std::ostream& os, const Function& obj);
@@ -575,31 +742,53 @@ public:
     void print(std::ostream& os) const override; // Override print method
     std::string get_class_name() const override;
 
-    static std::vector<std::string> execute_print_arg_names_;
-    static std::vector<std::string> execute_print_ret_arg_names_;
-    static std::vector<std::string> execute_input_arg_names_;
-    static std::vector<std::string> execute_input_int_arg_names_;
-    static std::vector<std::string> execute_clear_arg_names_;
-    static std::vector<std::string> execute_is_number_arg_names_;
-    static std::vector<std::string> execute_is_string_arg_names_;
-    static std::vector<std::string> execute_is_list_arg_names_;
-    static std::vector<std::string> execute_is_function_arg_names_;
-    static std::vector<std::string> execute_append_arg_names_;
-    static std::vector<std::string> execute_pop_arg_names_;
-    static std::vector<std::string> execute_extend_arg_names_;
-
-    static BuiltInFunction BuiltInFunction_print;
-    static BuiltInFunction BuiltInFunction_print_ret;
-    static BuiltInFunction BuiltInFunction_input;
-    static BuiltInFunction BuiltInFunction_input_int;
-    static BuiltInFunction BuiltInFunction_clear;
-    static BuiltInFunction BuiltInFunction_is_number;
-    static BuiltInFunction BuiltInFunction_is_string;
-    static BuiltInFunction BuiltInFunction_is_list;
-    static BuiltInFunction BuiltInFunction_is_function;
-    static BuiltInFunction BuiltInFunction_append;
-    static BuiltInFunction BuiltInFunction_pop;
-    static BuiltInFunction BuiltInFunction_extend;
+    static const std::vector<std::string> execute_print_arg_names_;
+    static const std::vector<std::string> execute_print_ret_arg_names_;
+    static const std::vector<std::string> execute_input_arg_names_;
+    static const std::vector<std::string> execute_input_int_arg_names_;
+    static const std::vector<std::string> execute_clear_arg_names_;
+    static const std::vector<std::string> execute_flush_arg_names_;
+    static const std::vector<std::string> execute_is_number_arg_names_;
+    static const std::vector<std::string> execute_is_string_arg_names_;
+    static const std::vector<std::string> execute_is_list_arg_names_;
+    static const std::vector<std::string> execute_is_function_arg_names_;
+    static const std::vector<std::string> execute_append_arg_names_;
+    static const std::vector<std::string> execute_pop_arg_names_;
+    static const std::vector<std::string> execute_extend_arg_names_;
+    static const std::vector<std::string> execute_parallel_map_arg_names_;
+    static const std::vector<std::string> execute_parallel_reduce_arg_names_;
+    static const std::vector<std::string> execute_reduce_arg_names_;
+    static const std::vector<std::string> execute_spawn_arg_names_;
+    static const std::vector<std::string> execute_await_arg_names_;
+    static const std::vector<std::string> execute_channel_arg_names_;
+    static const std::vector<std::string> execute_send_arg_names_;
+    static const std::vector<std::string> execute_recv_arg_names_;
+    static const std::vector<std::string> execute_close_arg_names_;
+    static const std::vector<std::string> execute_stats_arg_names_;
+
+    static const BuiltInFunction BuiltInFunction_print;
+    static const BuiltInFunction BuiltInFunction_print_ret;
+    static const BuiltInFunction BuiltInFunction_input;
+    static const BuiltInFunction BuiltInFunction_input_int;
+    static const BuiltInFunction BuiltInFunction_clear;
+    static const BuiltInFunction BuiltInFunction_flush;
+    static const BuiltInFunction BuiltInFunction_is_number;
+    static const BuiltInFunction BuiltInFunction_is_string;
+    static const BuiltInFunction BuiltInFunction_is_list;
+    static const BuiltInFunction BuiltInFunction_is_function;
+    static const BuiltInFunction BuiltInFunction_append;
+    static const BuiltInFunction BuiltInFunction_pop;
+    static const BuiltInFunction BuiltInFunction_extend;
+    static const BuiltInFunction BuiltInFunction_parallel_map;
+    static const BuiltInFunction BuiltInFunction_parallel_reduce;
+    static const BuiltInFunction BuiltInFunction_reduce;
+    static const BuiltInFunction BuiltInFunction_spawn;
+    static const BuiltInFunction BuiltInFunction_await;
+    static const BuiltInFunction BuiltInFunction_channel;
+    static const BuiltInFunction BuiltInFunction_send;
+    static const BuiltInFunction BuiltInFunction_recv;
+    static const BuiltInFunction BuiltInFunction_close;
+    static const BuiltInFunction BuiltInFunction_stats;
 };
 
 // Runtime Result
@@ -622,11 +811,21 @@ class SymbolTable
 public:
     SymbolTable(SymbolTable* parent=nullptr);
     std::shared_ptr<Node> get(std::string name);
+    std::shared_ptr<Node> get_local(const std::string& name); // this table only, no parents
     void set(std::string name, std::shared_ptr<Node> value);
     void remove(std::string name);
+    void clear();
+
+    // Numeric FOR counters: slot() looks the name up once and the loop then
+    // stores each value through the pointer, which stays valid until the name
+    // is removed. set_number() rewrites the Number already in the slot when
+    // nothing else holds it and only boxes a new one when it has escaped.
+    std::shared_ptr<Node>* slot(const std::string& name);
+    void set_number(std::shared_ptr<Node>* slot, double value);
 
     std::unordered_map<std::string, std::shared_ptr<Node>> symbols;
     SymbolTable* parent;
+    std::shared_mutex mutex; // SPAWNed tasks read the tables of the code that started them
 };
 
 // Interpreter
@@ -645,12 +844,168 @@ public:
     RTResult visit_UnaryOpNode(std::shared_ptr<Node> node, Context* context);
     RTResult visit_IfNode(std::shared_ptr<Node> node, Context* context);
     RTResult visit_ForNode(std::shared_ptr<Node> node, Context* context);
+    RTResult visit_ParallelForNode(std::shared_ptr<Node> node, Context* context, double start, double bound, double step);
     RTResult visit_WhileNode(std::shared_ptr<Node> node, Context* context);
     RTResult visit_FuncDefNode(std::shared_ptr<Node> node, Context* context);
     RTResult visit_CallNode(std::shared_ptr<Node> node, Context* context);
+    RTResult visit_CachedNode(std::shared_ptr<Node> node, Context* context);
+
+    // What the visit of a node does once its children have been evaluated,
+    // shared by the visit methods and Evaluator
+    RTResult finish_ListNode(std::shared_ptr<Node> node, std::vector<std::shared_ptr<Node>> elements, Context* context);
+    RTResult finish_VarAssignNode(std::shared_ptr<Node> node, std::shared_ptr<Node> value, Context* context);
+    RTResult finish_BinOpNode(std::shared_ptr<Node> node, BinOpNode::QuickOp quick_op, std::shared_ptr<Node> left, std::shared_ptr<Node> right, Context* context);
+    RTResult finish_UnaryOpNode(std::shared_ptr<Node> node, std::shared_ptr<Node> number);
+    RTResult finish_CallNode(std::shared_ptr<Node> node, std::shared_ptr<Node> return_value, Context* context);
+    RTResult finish_CachedNode(std::shared_ptr<Node> node, std::shared_ptr<Node> value, Context* context);
+};
+
+// Evaluator
+// Evaluates a node to the same result as Interpreter::visit, but keeps the
+// nodes it is in the middle of on a work stack of its own instead of the C++
+// call stack, so calls can nest as deep as memory and
+// ExecutionLimits::max_stack_depth allow (basic --stackless). Each step does
+// one piece of one node's work with the Interpreter's visit and finish
+// methods. resume() stops after a number of steps and picks up where it left
+// off on the next call, so an evaluation can be suspended.
+class TraceScope;
+class ProfileScope;
+
+class Evaluator
+{
+public:
+    Evaluator(std::shared_ptr<Node> node, Context* context);
+    // Runs up to max_steps steps; true once the evaluation is done and result is set
+    bool resume(uint64_t max_steps = UINT64_MAX);
+    RTResult run();
+
+    RTResult result;
+
+private:
+    // A node being evaluated and how far along it is
+    struct Task
+    {
+        std::shared_ptr<Node> node;
+        Context* context;
+        ExecutionStats::NodeKind kind;
+        int step = 0;
+        size_t index = 0;                        // element, case or argument
+        std::vector<std::shared_ptr<Node>> values; // of the children so far
+        std::shared_ptr<Node> held;              // left operand or callee
+        BinOpNode::QuickOp quick_op = BinOpNode::QuickOp::Unresolved;
+        double counter = 0, end = 0, increment = 0; // FOR
+        std::shared_ptr<Node>* slot = nullptr;   // FOR counter
+        std::shared_ptr<Function> function;      // user function being called
+        Context* frame = nullptr;                // and the frame it runs in
+        std::shared_ptr<TraceScope> trace_scope; // after function, which it points into
+        std::shared_ptr<ProfileScope> profile_scope;
+        std::chrono::steady_clock::time_point started;
+    };
+
+    void push(std::shared_ptr<Node> node, Context* context);
+    void step();
+    // Pops the innermost task and hands its value to the one below, or
+    // unwinds every task on an error
+    void complete(RTResult res);
+
+    std::vector<Task> tasks;
+    std::shared_ptr<Node> received; // value of the last task completed
+    Interpreter interpreter;
+};
+
+// Execution limits
+// What one execution of an instance may use, 0 means no limit. They are
+// checked as nodes are evaluated, and a run that exceeds one stops with a
+// runtime error at the node where it happened.
+struct ExecutionLimits
+{
+    uint64_t max_operations = 0; // nodes evaluated
+    size_t max_call_depth = 0;   // nested call frames
+    double max_seconds = 0;      // wall time
+    size_t max_bytes = 0;        // bytes allocated for strings, lists and frames
+    size_t max_stack_depth = 0;  // nodes Evaluator is in the middle of at once
+};
+
+// Interpreter instance
+// Owns everything a running program can change: the global symbol table, the
+// output sink and the contexts and symbol tables created for function calls.
+// Any number of instances can run on different threads at once, and a parsed
+// program can be executed by several of them concurrently. The one part of
+// the program the interpreter writes is BinOpNode::quick_op, a hint as to
+// which handler suits the node's operands. It is an atomic, and the operands
+// are still checked before the hint is acted on unless infer_types proved
+// them Numbers, so a hint left by another instance can cost speed but never
+// change a result.
+class InterpreterInstance
+{
+public:
+    InterpreterInstance(int output_fd = 1);
+
+    InterpreterInstance(const InterpreterInstance&) = delete;
+    InterpreterInstance& operator=(const InterpreterInstance&) = delete;
+
+    RTResult execute(std::shared_ptr<Node> ast);
+    void task_started();
+    void task_finished();
+    bool wait_for_tasks();
+    // When blocking waits give up: the deadline of the time limit, or
+    // time_point::max() if there is none
+    std::chrono::steady_clock::time_point wait_deadline() const;
+    Error time_limit_error(Position pos_start, Position pos_end, Context* context) const;
+    std::pair<std::shared_ptr<Node>, Error> run(std::string fn, std::string_view text);
+    Context* new_context(std::string display_name, Context* parent, Position parent_entry_pos);
+    // Hands a call's frame back for reuse by new_context once the call has
+    // returned, unless it is captured
+    void release_context(Context* context);
+    void reset();
+    Error check_limits(Position pos_start, Position pos_end, Context* context);
+    // Adds the nodes evaluated on this thread since the last check to the
+    // instance's count, see OperationCountScope
+    void flush_operations();
+    void charge_bytes(size_t bytes);
+    // Bytes the memory limit still allows, SIZE_MAX if there is none. Checked
+    // before building a string or list whose size is known up front, so one
+    // too large for the limit fails with memory_limit_error, not bad_alloc.
+    size_t bytes_left() const;
+    Error memory_limit_error(Position pos_start, Position pos_end, Context* context) const;
+
+    SymbolTable globals;
+    OutputSink output;
+    ExecutionLimits limits;
+    RunSummary summary; // of the last run() or execute()
+    bool stackless = false; // evaluate with Evaluator instead of Interpreter::visit
+    // Values made by the current execution, counted through a ValueCountScope
+    // on every thread that runs part of it
+    std::atomic<uint64_t> values_created;
+
+private:
+    void add_builtins();
+
+    Context root;
+    std::mutex arena_mutex; // PARFOR workers create frames concurrently
+    std::mutex tasks_mutex;
+    std::condition_variable tasks_done;
+    size_t running_tasks = 0;
+    std::deque<Context> contexts;
+    std::deque<SymbolTable> symbol_tables;
+    std::vector<Context*> free_contexts; // released, each with its own symbol table
+    size_t frames_created = 0;
+    std::atomic<uint64_t> operations;
+    std::atomic<size_t> allocated_bytes;
+    std::chrono::steady_clock::time_point deadline;
 };
 
 // Run
-extern SymbolTable global_symbol_table;
-
-std::pair<std::shared_ptr<Node>, Error> run(std::string fn, std::string text);
\ No newline at end of file
+// Lexes and parses a program without running it. The caller owns the source
+// text and must keep it alive for as long as the returned nodes are in use.
+// Fills in the lex and parse phases of summary if one is given. The program
+// goes through the passes in passes.h; globals, if given, are the ones it
+// will run against, see fold_constants.
+std::pair<std::shared_ptr<Node>, Error> parse_program(std::string fn, std::string_view text, RunSummary* summary = nullptr, SymbolTable* globals = nullptr);
+
+// The instance used by run() and the shell
+InterpreterInstance& default_interpreter();
+
+// The caller owns the source text and must keep it alive for as long as the
+// returned nodes, errors or any functions defined by the program are in use.
+std::pair<std::shared_ptr<Node>, Error> run(std::string fn, std::string_view text);
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "basic_api.h"
+#include "basic.h"
+#include "passes.h"
+#include <cstdlib>
+#include <cstring>
+
+HostValue::HostValue()
+    : type(Type::None), number(0) {}
+
+HostValue::HostValue(double number)
+    : type(Type::Number), number(number) {}
+
+HostValue::HostValue(std::string string)
+    : type(Type::String), number(0), string(string) {}
+
+HostValue::HostValue(const char* string)
+    : type(Type::String), number(0), string(string) {}
+
+HostValue::HostValue(std::vector<HostValue> list)
+    : type(Type::List), number(0), list(list) {}
+
+CompiledProgram::CompiledProgram(std::string name, std::string source)
+    : name(name), source(source) {
+    std::pair<std::shared_ptr<Node>, Error> parsed = parse_program(this->name, this->source, &summary);
+    if (parsed.second.is_error() != "None") error = parsed.second.as_string();
+    else ast = parsed.first;
+}
+
+bool CompiledProgram::is_valid() const {
+    return error.empty();
+}
+
+bool ExecutionResult::is_ok() const {
+    return error.empty();
+}
+
+static std::shared_ptr<Node> to_node(const HostValue& value) {
+    if (value.type == HostValue::Type::Number) return std::make_shared<Number>(Number(value.number));
+    if (value.type == HostValue::Type::String) return std::make_shared<String>(String(value.string));
+    if (value.type == HostValue::Type::List) {
+        std::vector<std::shared_ptr<Node>> elements;
+        for (const HostValue& element : value.list) elements.push_back(to_node(element));
+        return std::make_shared<List>(List(elements));
+    }
+    return std::make_shared<Number>(Number::null_);
+}
+
+static HostValue to_host_value(std::shared_ptr<Node> node) {
+    HostValue value;
+    if (node == nullptr) return value;
+
+    if (node->get_class_name() == "Number") {
+        if (!std::dynamic_pointer_cast<Number>(node)->is_none) value = HostValue(std::dynamic_pointer_cast<Number>(node)->value);
+    }
+    else if (node->get_class_name() == "String") {
+        value = HostValue(std::dynamic_pointer_cast<String>(node)->value);
+    }
+    else if (node->get_class_name() == "List") {
+        value.type = HostValue::Type::List;
+        for (auto element : std::dynamic_pointer_cast<List>(node)->elements) value.list.push_back(to_host_value(element));
+    }
+    else if (node->get_class_name() == "Function" || node->get_class_name() == "BuiltInFunction") {
+        value.type = HostValue::Type::Function;
+        value.string = std::dynamic_pointer_cast<BaseFunction>(node)->name;
+    }
+    return value;
+}
+
+std::shared_ptr<const CompiledProgram> compile(std::string source, std::string name) {
+    return std::make_shared<const CompiledProgram>(name, source);
+}
+
+ExecutionResult execute(const CompiledProgram& program, const Bindings& bindings) {
+    return execute(program, bindings, ExecutionLimits());
+}
+
+ExecutionResult execute(const CompiledProgram& program, const Bindings& bindings, const ExecutionLimits& limits) {
+    ExecutionResult result;
+    if (!program.is_valid()) {
+        result.error = program.error;
+        return result;
+    }
+
+    for (auto& binding : bindings) {
+        if (is_builtin_constant(binding.first)) {
+            result.error = "Cannot bind '" + binding.first + "': it is a builtin constant";
+            return result;
+        }
+    }
+
+    thread_local InterpreterInstance instance;
+    instance.limits = limits;
+    for (auto& binding : bindings) instance.globals.set(binding.first, to_node(binding.second));
+
+    // The program is a list of statements and evaluates to a list of their values
+    RTResult runtime = instance.execute(program.ast);
+    result.summary = instance.summary;
+    result.summary.set_parse_phases(program.summary);
+    if (runtime.error.is_error() != "None") {
+        result.error = runtime.error.as_string();
+    }
+    else if (runtime.value != nullptr && runtime.value->get_class_name() == "List") {
+        std::vector<std::shared_ptr<Node>>& values = std::dynamic_pointer_cast<List>(runtime.value)->elements;
+        if (!values.empty()) result.value = to_host_value(values.back());
+    }
+
+    instance.reset();
+    return result;
+}
+
+////////////////////////////
+////////// C API ///////////
+////////////////////////////
+
+struct basic_program
+{
+    std::shared_ptr<const CompiledProgram> program;
+};
+
+static char* copy_string(const std::string& text) {
+    char* copy = static_cast<char*>(std::malloc(text.size() + 1));
+    if (copy != nullptr) std::memcpy(copy, text.c_str(), text.size() + 1);
+    return copy;
+}
+
+basic_program* basic_compile(const char* source, size_t length, char** error) {
+    std::shared_ptr<const CompiledProgram> program = compile(std::string(source, length));
+    if (!program->is_valid()) {
+        if (error != nullptr) *error = copy_string(program->error);
+        return nullptr;
+    }
+    return new basic_program{ program };
+}
+
+// Returns 0 and stores the number the program evaluates to, or returns -1
+int basic_execute_number(const basic_program* program, const char* const* names, const double* values, size_t count, double* result, char** error) {
+    Bindings bindings;
+    for (size_t i = 0; i < count; i++) bindings[names[i]] = HostValue(values[i]);
+
+    ExecutionResult outcome = execute(*program->program, bindings);
+    if (!outcome.is_ok()) {
+        if (error != nullptr) *error = copy_string(outcome.error);
+        return -1;
+    }
+    if (outcome.value.type != HostValue::Type::Number) {
+        if (error != nullptr) *error = copy_string("Program did not evaluate to a number");
+        return -1;
+    }
+    *result = outcome.value.number;
+    return 0;
+}
+
+void basic_free_program(basic_program* program) {
+    delete program;
+}
+
+void basic_free_string(char* string) {
+    std::free(string);
+}
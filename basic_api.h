@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "stats.h"
+
+class Node;
+struct ExecutionLimits;
+
+// Embedding API: parse a program once with compile() and run it as often as
+// needed with execute(), on any number of threads at once.
+
+// A value passed between the host and a program
+class HostValue
+{
+public:
+    enum class Type { None, Number, String, List, Function };
+
+    HostValue();
+    HostValue(double number);
+    HostValue(std::string string);
+    HostValue(const char* string);
+    HostValue(std::vector<HostValue> list);
+
+    Type type;
+    double number;
+    std::string string; // also the name of a function
+    std::vector<HostValue> list;
+};
+
+// Parsed program. Never changes once compiled, so one handle can be executed
+// by many threads at the same time.
+class CompiledProgram
+{
+public:
+    CompiledProgram(std::string name, std::string source);
+    CompiledProgram(const CompiledProgram&) = delete;
+    CompiledProgram& operator=(const CompiledProgram&) = delete;
+
+    bool is_valid() const;
+
+    const std::string name;
+    const std::string source; // the AST points into it
+    std::shared_ptr<Node> ast;
+    std::string error;        // syntax error, empty if the program parsed
+    RunSummary summary;       // lex and parse phases
+};
+
+class ExecutionResult
+{
+public:
+    bool is_ok() const;
+
+    HostValue value;   // value of the last statement
+    std::string error; // runtime error with traceback, empty on success
+    RunSummary summary; // the program's lex and parse phases and this run
+};
+
+typedef std::unordered_map<std::string, HostValue> Bindings;
+
+std::shared_ptr<const CompiledProgram> compile(std::string source, std::string name = "<embedded>");
+
+// Runs the program on an interpreter instance owned by the calling thread,
+// with bindings set as globals on top of the builtins. Nothing one
+// execution defines is visible to the next. Bindings cannot replace the
+// builtin constants (NULL, TRUE, FALSE, MATH_PI), which compile() folds.
+ExecutionResult execute(const CompiledProgram& program, const Bindings& bindings = Bindings());
+
+// As above, but a run that exceeds one of the limits ends with an error
+ExecutionResult execute(const CompiledProgram& program, const Bindings& bindings, const ExecutionLimits& limits);
+
+extern "C" {
+#endif
+
+// C interface for numeric formulas. Error strings are set only on failure
+// and must be released with basic_free_string.
+typedef struct basic_program basic_program;
+
+basic_program* basic_compile(const char* source, size_t length, char** error);
+int basic_execute_number(const basic_program* program, const char* const* names, const double* values, size_t count, double* result, char** error);
+void basic_free_program(basic_program* program);
+void basic_free_string(char* string);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,2 @@
+VAR count = 0
+FOR i = 0 TO 3000 THEN VAR count = count + IS_NUM(i) + IS_STR("a") + IS_LIST([i]) + IS_FUN(APPEND)
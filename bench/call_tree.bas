@@ -0,0 +1,2 @@
+FUN tree(n) -> n < 2 OR (tree(n - 1) AND tree(n - 2))
+tree(16)
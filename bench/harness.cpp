@@ -0,0 +1,236 @@
+// basic_bench: runs each benchmark program in three isolated modes
+//   lex    Lexer::make_tokens only
+//   parse  lexing and parsing, as parse_program does it
+//   run    executing the already parsed program on a reset instance
+// and prints latency percentiles, throughput, peak RSS and heap allocations
+// per mode as JSON. On POSIX every program is measured in a child process
+// of its own so that peak RSS belongs to that program alone.
+//
+// usage: basic_bench [--runs=N] [--warmup=N] [--modes=lex,parse,run] program.bas...
+
+#include "../basic.h"
+#include "../source_file.h"
+#include "../stats.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+////////////////////////////
+//////// ALLOCATIONS ///////
+////////////////////////////
+
+static std::atomic<uint64_t> allocation_count(0);
+static std::atomic<uint64_t> allocated_bytes(0);
+
+void* operator new(size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+////////////////////////////
+////////// BENCH ///////////
+////////////////////////////
+
+typedef std::chrono::steady_clock Clock;
+
+struct Options
+{
+    size_t runs = 20;
+    size_t warmup = 2;
+    std::vector<std::string> modes = { "lex", "parse", "run" };
+};
+
+// The interpreter traces every step to std::cout, which would swamp what is
+// measured, so it writes into a sink that drops everything while timing
+class NullBuffer : public std::streambuf
+{
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+static uint64_t percentile(std::vector<uint64_t> sorted, double fraction) {
+    if (sorted.empty()) return 0;
+    return sorted[static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5)];
+}
+
+// Times one mode of one program. Returns an empty error string on success.
+static std::string measure(const std::string& mode, const std::string& path, std::string_view source, const Options& options, std::ostringstream& out) {
+    std::shared_ptr<Node> ast;
+    InterpreterInstance instance;
+    instance.output.set_writer([](std::string_view) {});
+
+    if (mode == "run") {
+        std::pair<std::shared_ptr<Node>, Error> parsed = parse_program(path, source);
+        if (parsed.second.is_error() != "None") return parsed.second.as_string();
+        ast = parsed.first;
+    }
+
+    std::vector<uint64_t> samples;
+    uint64_t allocations_before = 0, bytes_before = 0;
+    for (size_t i = 0; i < options.warmup + options.runs; i++) {
+        if (i == options.warmup) {
+            allocations_before = allocation_count.load();
+            bytes_before = allocated_bytes.load();
+        }
+
+        Clock::time_point started = Clock::now();
+        Error error = Error();
+        if (mode == "lex") {
+            Lexer lexer(path, source);
+            error = lexer.make_tokens().second;
+        }
+        else if (mode == "parse") {
+            error = parse_program(path, source).second;
+        }
+        else {
+            error = instance.execute(ast).error;
+            instance.reset();
+        }
+        Clock::time_point finished = Clock::now();
+
+        if (error.is_error() != "None") return error.as_string();
+        if (i >= options.warmup) samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(finished - started).count());
+    }
+    uint64_t allocations = allocation_count.load() - allocations_before;
+    uint64_t bytes = allocated_bytes.load() - bytes_before;
+
+    std::sort(samples.begin(), samples.end());
+    double mean_ns = 0;
+    for (uint64_t sample : samples) mean_ns += sample;
+    mean_ns /= samples.size();
+
+    out << "\"" << mode << "\":{\"runs\":" << samples.size()
+        << ",\"median_ns\":" << percentile(samples, 0.50)
+        << ",\"p99_ns\":" << percentile(samples, 0.99)
+        << ",\"min_ns\":" << samples.front()
+        << ",\"runs_per_second\":" << 1e9 / mean_ns;
+    if (mode != "run") out << ",\"source_mb_per_second\":" << source.size() / mean_ns * 1e3;
+    out << ",\"allocations_per_run\":" << allocations / samples.size()
+        << ",\"allocated_bytes_per_run\":" << bytes / samples.size() << "}";
+    return "";
+}
+
+static std::string bench_program(const std::string& path, const Options& options) {
+    std::ostringstream out;
+    out << "{\"program\":\"" << path << "\"";
+
+    SourceFile source(path);
+    if (!source.is_open()) {
+        out << ",\"error\":\"" << source.error << "\"}";
+        return out.str();
+    }
+    out << ",\"source_bytes\":" << source.text().size();
+
+    NullBuffer null_buffer;
+    std::streambuf* console = std::cout.rdbuf(&null_buffer);
+    for (const std::string& mode : options.modes) {
+        std::ostringstream result;
+        std::string error = measure(mode, path, source.text(), options, result);
+        if (!error.empty()) {
+            std::replace(error.begin(), error.end(), '"', '\'');
+            std::replace(error.begin(), error.end(), '\n', ' ');
+            out << ",\"" << mode << "\":{\"error\":\"" << error << "\"}";
+        }
+        else out << "," << result.str();
+    }
+    std::cout.rdbuf(console);
+
+    out << ",\"peak_rss_kb\":" << peak_rss_kb() << "}";
+    return out.str();
+}
+
+// Runs bench_program in a fresh child process and collects its JSON through a pipe
+static std::string bench_isolated(const std::string& path, const Options& options) {
+#ifdef _WIN32
+    return bench_program(path, options);
+#else
+    int fds[2];
+    if (pipe(fds) < 0) return bench_program(path, options);
+
+    std::cout.flush();
+    pid_t child = fork();
+    if (child == 0) {
+        close(fds[0]);
+        std::string result = bench_program(path, options);
+        ssize_t written = write(fds[1], result.data(), result.size());
+        _exit(written == static_cast<ssize_t>(result.size()) ? 0 : 1);
+    }
+    close(fds[1]);
+
+    std::string result;
+    char buffer[4096];
+    ssize_t got;
+    while ((got = read(fds[0], buffer, sizeof(buffer))) > 0) result.append(buffer, got);
+    close(fds[0]);
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    if (child < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        return "{\"program\":\"" + path + "\",\"error\":\"benchmark process failed\"}";
+    }
+    return result;
+#endif
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    std::vector<std::string> programs;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.rfind("--runs=", 0) == 0) options.runs = std::max<size_t>(1, std::stoul(arg.substr(7)));
+        else if (arg.rfind("--warmup=", 0) == 0) options.warmup = std::stoul(arg.substr(9));
+        else if (arg.rfind("--modes=", 0) == 0) {
+            options.modes.clear();
+            std::istringstream modes(arg.substr(8));
+            std::string mode;
+            while (std::getline(modes, mode, ',')) {
+                if (mode != "lex" && mode != "parse" && mode != "run") {
+                    std::cerr << "basic_bench: unknown mode '" << mode << "'" << std::endl;
+                    return 2;
+                }
+                options.modes.push_back(mode);
+            }
+        }
+        else if (arg.rfind("--", 0) == 0) {
+            std::cerr << "usage: basic_bench [--runs=N] [--warmup=N] [--modes=lex,parse,run] program.bas..." << std::endl;
+            return 2;
+        }
+        else programs.push_back(arg);
+    }
+
+    if (programs.empty()) {
+        std::cerr << "usage: basic_bench [--runs=N] [--warmup=N] [--modes=lex,parse,run] program.bas..." << std::endl;
+        return 2;
+    }
+
+    std::cout << "{\"benchmarks\":[" << std::endl;
+    for (size_t i = 0; i < programs.size(); i++) {
+        std::cout << bench_isolated(programs[i], options) << (i + 1 < programs.size() ? "," : "") << std::endl;
+    }
+    std::cout << "]}" << std::endl;
+    return 0;
+}
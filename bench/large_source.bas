@@ -0,0 +1,1001 @@
+FUN helper_0(a, b) -> (a * 0 + b) / (0 + 1) - a ^ 2
+VAR value_0 = [0, 0.5, "text 0", helper_0]
+FUN helper_1(a, b) -> (a * 1 + b) / (1 + 1) - a ^ 2
+VAR value_1 = [1, 1.5, "text 1", helper_1]
+FUN helper_2(a, b) -> (a * 2 + b) / (2 + 1) - a ^ 2
+VAR value_2 = [2, 2.5, "text 2", helper_2]
+FUN helper_3(a, b) -> (a * 3 + b) / (3 + 1) - a ^ 2
+VAR value_3 = [3, 3.5, "text 3", helper_3]
+FUN helper_4(a, b) -> (a * 4 + b) / (4 + 1) - a ^ 2
+VAR value_4 = [4, 4.5, "text 4", helper_4]
+FUN helper_5(a, b) -> (a * 5 + b) / (5 + 1) - a ^ 2
+VAR value_5 = [5, 5.5, "text 5", helper_5]
+FUN helper_6(a, b) -> (a * 6 + b) / (6 + 1) - a ^ 2
+VAR value_6 = [6, 6.5, "text 6", helper_6]
+FUN helper_7(a, b) -> (a * 7 + b) / (7 + 1) - a ^ 2
+VAR value_7 = [7, 7.5, "text 7", helper_7]
+FUN helper_8(a, b) -> (a * 8 + b) / (8 + 1) - a ^ 2
+VAR value_8 = [8, 8.5, "text 8", helper_8]
+FUN helper_9(a, b) -> (a * 9 + b) / (9 + 1) - a ^ 2
+VAR value_9 = [9, 9.5, "text 9", helper_9]
+FUN helper_10(a, b) -> (a * 10 + b) / (10 + 1) - a ^ 2
+VAR value_10 = [10, 10.5, "text 10", helper_10]
+FUN helper_11(a, b) -> (a * 11 + b) / (11 + 1) - a ^ 2
+VAR value_11 = [11, 11.5, "text 11", helper_11]
+FUN helper_12(a, b) -> (a * 12 + b) / (12 + 1) - a ^ 2
+VAR value_12 = [12, 12.5, "text 12", helper_12]
+FUN helper_13(a, b) -> (a * 13 + b) / (13 + 1) - a ^ 2
+VAR value_13 = [13, 13.5, "text 13", helper_13]
+FUN helper_14(a, b) -> (a * 14 + b) / (14 + 1) - a ^ 2
+VAR value_14 = [14, 14.5, "text 14", helper_14]
+FUN helper_15(a, b) -> (a * 15 + b) / (15 + 1) - a ^ 2
+VAR value_15 = [15, 15.5, "text 15", helper_15]
+FUN helper_16(a, b) -> (a * 16 + b) / (16 + 1) - a ^ 2
+VAR value_16 = [16, 16.5, "text 16", helper_16]
+FUN helper_17(a, b) -> (a * 17 + b) / (17 + 1) - a ^ 2
+VAR value_17 = [17, 17.5, "text 17", helper_17]
+FUN helper_18(a, b) -> (a * 18 + b) / (18 + 1) - a ^ 2
+VAR value_18 = [18, 18.5, "text 18", helper_18]
+FUN helper_19(a, b) -> (a * 19 + b) / (19 + 1) - a ^ 2
+VAR value_19 = [19, 19.5, "text 19", helper_19]
+FUN helper_20(a, b) -> (a * 20 + b) / (20 + 1) - a ^ 2
+VAR value_20 = [20, 20.5, "text 20", helper_20]
+FUN helper_21(a, b) -> (a * 21 + b) / (21 + 1) - a ^ 2
+VAR value_21 = [21, 21.5, "text 21", helper_21]
+FUN helper_22(a, b) -> (a * 22 + b) / (22 + 1) - a ^ 2
+VAR value_22 = [22, 22.5, "text 22", helper_22]
+FUN helper_23(a, b) -> (a * 23 + b) / (23 + 1) - a ^ 2
+VAR value_23 = [23, 23.5, "text 23", helper_23]
+FUN helper_24(a, b) -> (a * 24 + b) / (24 + 1) - a ^ 2
+VAR value_24 = [24, 24.5, "text 24", helper_24]
+FUN helper_25(a, b) -> (a * 25 + b) / (25 + 1) - a ^ 2
+VAR value_25 = [25, 25.5, "text 25", helper_25]
+FUN helper_26(a, b) -> (a * 26 + b) / (26 + 1) - a ^ 2
+VAR value_26 = [26, 26.5, "text 26", helper_26]
+FUN helper_27(a, b) -> (a * 27 + b) / (27 + 1) - a ^ 2
+VAR value_27 = [27, 27.5, "text 27", helper_27]
+FUN helper_28(a, b) -> (a * 28 + b) / (28 + 1) - a ^ 2
+VAR value_28 = [28, 28.5, "text 28", helper_28]
+FUN helper_29(a, b) -> (a * 29 + b) / (29 + 1) - a ^ 2
+VAR value_29 = [29, 29.5, "text 29", helper_29]
+FUN helper_30(a, b) -> (a * 30 + b) / (30 + 1) - a ^ 2
+VAR value_30 = [30, 30.5, "text 30", helper_30]
+FUN helper_31(a, b) -> (a * 31 + b) / (31 + 1) - a ^ 2
+VAR value_31 = [31, 31.5, "text 31", helper_31]
+FUN helper_32(a, b) -> (a * 32 + b) / (32 + 1) - a ^ 2
+VAR value_32 = [32, 32.5, "text 32", helper_32]
+FUN helper_33(a, b) -> (a * 33 + b) / (33 + 1) - a ^ 2
+VAR value_33 = [33, 33.5, "text 33", helper_33]
+FUN helper_34(a, b) -> (a * 34 + b) / (34 + 1) - a ^ 2
+VAR value_34 = [34, 34.5, "text 34", helper_34]
+FUN helper_35(a, b) -> (a * 35 + b) / (35 + 1) - a ^ 2
+VAR value_35 = [35, 35.5, "text 35", helper_35]
+FUN helper_36(a, b) -> (a * 36 + b) / (36 + 1) - a ^ 2
+VAR value_36 = [36, 36.5, "text 36", helper_36]
+FUN helper_37(a, b) -> (a * 37 + b) / (37 + 1) - a ^ 2
+VAR value_37 = [37, 37.5, "text 37", helper_37]
+FUN helper_38(a, b) -> (a * 38 + b) / (38 + 1) - a ^ 2
+VAR value_38 = [38, 38.5, "text 38", helper_38]
+FUN helper_39(a, b) -> (a * 39 + b) / (39 + 1) - a ^ 2
+VAR value_39 = [39, 39.5, "text 39", helper_39]
+FUN helper_40(a, b) -> (a * 40 + b) / (40 + 1) - a ^ 2
+VAR value_40 = [40, 40.5, "text 40", helper_40]
+FUN helper_41(a, b) -> (a * 41 + b) / (41 + 1) - a ^ 2
+VAR value_41 = [41, 41.5, "text 41", helper_41]
+FUN helper_42(a, b) -> (a * 42 + b) / (42 + 1) - a ^ 2
+VAR value_42 = [42, 42.5, "text 42", helper_42]
+FUN helper_43(a, b) -> (a * 43 + b) / (43 + 1) - a ^ 2
+VAR value_43 = [43, 43.5, "text 43", helper_43]
+FUN helper_44(a, b) -> (a * 44 + b) / (44 + 1) - a ^ 2
+VAR value_44 = [44, 44.5, "text 44", helper_44]
+FUN helper_45(a, b) -> (a * 45 + b) / (45 + 1) - a ^ 2
+VAR value_45 = [45, 45.5, "text 45", helper_45]
+FUN helper_46(a, b) -> (a * 46 + b) / (46 + 1) - a ^ 2
+VAR value_46 = [46, 46.5, "text 46", helper_46]
+FUN helper_47(a, b) -> (a * 47 + b) / (47 + 1) - a ^ 2
+VAR value_47 = [47, 47.5, "text 47", helper_47]
+FUN helper_48(a, b) -> (a * 48 + b) / (48 + 1) - a ^ 2
+VAR value_48 = [48, 48.5, "text 48", helper_48]
+FUN helper_49(a, b) -> (a * 49 + b) / (49 + 1) - a ^ 2
+VAR value_49 = [49, 49.5, "text 49", helper_49]
+FUN helper_50(a, b) -> (a * 50 + b) / (50 + 1) - a ^ 2
+VAR value_50 = [50, 50.5, "text 50", helper_50]
+FUN helper_51(a, b) -> (a * 51 + b) / (51 + 1) - a ^ 2
+VAR value_51 = [51, 51.5, "text 51", helper_51]
+FUN helper_52(a, b) -> (a * 52 + b) / (52 + 1) - a ^ 2
+VAR value_52 = [52, 52.5, "text 52", helper_52]
+FUN helper_53(a, b) -> (a * 53 + b) / (53 + 1) - a ^ 2
+VAR value_53 = [53, 53.5, "text 53", helper_53]
+FUN helper_54(a, b) -> (a * 54 + b) / (54 + 1) - a ^ 2
+VAR value_54 = [54, 54.5, "text 54", helper_54]
+FUN helper_55(a, b) -> (a * 55 + b) / (55 + 1) - a ^ 2
+VAR value_55 = [55, 55.5, "text 55", helper_55]
+FUN helper_56(a, b) -> (a * 56 + b) / (56 + 1) - a ^ 2
+VAR value_56 = [56, 56.5, "text 56", helper_56]
+FUN helper_57(a, b) -> (a * 57 + b) / (57 + 1) - a ^ 2
+VAR value_57 = [57, 57.5, "text 57", helper_57]
+FUN helper_58(a, b) -> (a * 58 + b) / (58 + 1) - a ^ 2
+VAR value_58 = [58, 58.5, "text 58", helper_58]
+FUN helper_59(a, b) -> (a * 59 + b) / (59 + 1) - a ^ 2
+VAR value_59 = [59, 59.5, "text 59", helper_59]
+FUN helper_60(a, b) -> (a * 60 + b) / (60 + 1) - a ^ 2
+VAR value_60 = [60, 60.5, "text 60", helper_60]
+FUN helper_61(a, b) -> (a * 61 + b) / (61 + 1) - a ^ 2
+VAR value_61 = [61, 61.5, "text 61", helper_61]
+FUN helper_62(a, b) -> (a * 62 + b) / (62 + 1) - a ^ 2
+VAR value_62 = [62, 62.5, "text 62", helper_62]
+FUN helper_63(a, b) -> (a * 63 + b) / (63 + 1) - a ^ 2
+VAR value_63 = [63, 63.5, "text 63", helper_63]
+FUN helper_64(a, b) -> (a * 64 + b) / (64 + 1) - a ^ 2
+VAR value_64 = [64, 64.5, "text 64", helper_64]
+FUN helper_65(a, b) -> (a * 65 + b) / (65 + 1) - a ^ 2
+VAR value_65 = [65, 65.5, "text 65", helper_65]
+FUN helper_66(a, b) -> (a * 66 + b) / (66 + 1) - a ^ 2
+VAR value_66 = [66, 66.5, "text 66", helper_66]
+FUN helper_67(a, b) -> (a * 67 + b) / (67 + 1) - a ^ 2
+VAR value_67 = [67, 67.5, "text 67", helper_67]
+FUN helper_68(a, b) -> (a * 68 + b) / (68 + 1) - a ^ 2
+VAR value_68 = [68, 68.5, "text 68", helper_68]
+FUN helper_69(a, b) -> (a * 69 + b) / (69 + 1) - a ^ 2
+VAR value_69 = [69, 69.5, "text 69", helper_69]
+FUN helper_70(a, b) -> (a * 70 + b) / (70 + 1) - a ^ 2
+VAR value_70 = [70, 70.5, "text 70", helper_70]
+FUN helper_71(a, b) -> (a * 71 + b) / (71 + 1) - a ^ 2
+VAR value_71 = [71, 71.5, "text 71", helper_71]
+FUN helper_72(a, b) -> (a * 72 + b) / (72 + 1) - a ^ 2
+VAR value_72 = [72, 72.5, "text 72", helper_72]
+FUN helper_73(a, b) -> (a * 73 + b) / (73 + 1) - a ^ 2
+VAR value_73 = [73, 73.5, "text 73", helper_73]
+FUN helper_74(a, b) -> (a * 74 + b) / (74 + 1) - a ^ 2
+VAR value_74 = [74, 74.5, "text 74", helper_74]
+FUN helper_75(a, b) -> (a * 75 + b) / (75 + 1) - a ^ 2
+VAR value_75 = [75, 75.5, "text 75", helper_75]
+FUN helper_76(a, b) -> (a * 76 + b) / (76 + 1) - a ^ 2
+VAR value_76 = [76, 76.5, "text 76", helper_76]
+FUN helper_77(a, b) -> (a * 77 + b) / (77 + 1) - a ^ 2
+VAR value_77 = [77, 77.5, "text 77", helper_77]
+FUN helper_78(a, b) -> (a * 78 + b) / (78 + 1) - a ^ 2
+VAR value_78 = [78, 78.5, "text 78", helper_78]
+FUN helper_79(a, b) -> (a * 79 + b) / (79 + 1) - a ^ 2
+VAR value_79 = [79, 79.5, "text 79", helper_79]
+FUN helper_80(a, b) -> (a * 80 + b) / (80 + 1) - a ^ 2
+VAR value_80 = [80, 80.5, "text 80", helper_80]
+FUN helper_81(a, b) -> (a * 81 + b) / (81 + 1) - a ^ 2
+VAR value_81 = [81, 81.5, "text 81", helper_81]
+FUN helper_82(a, b) -> (a * 82 + b) / (82 + 1) - a ^ 2
+VAR value_82 = [82, 82.5, "text 82", helper_82]
+FUN helper_83(a, b) -> (a * 83 + b) / (83 + 1) - a ^ 2
+VAR value_83 = [83, 83.5, "text 83", helper_83]
+FUN helper_84(a, b) -> (a * 84 + b) / (84 + 1) - a ^ 2
+VAR value_84 = [84, 84.5, "text 84", helper_84]
+FUN helper_85(a, b) -> (a * 85 + b) / (85 + 1) - a ^ 2
+VAR value_85 = [85, 85.5, "text 85", helper_85]
+FUN helper_86(a, b) -> (a * 86 + b) / (86 + 1) - a ^ 2
+VAR value_86 = [86, 86.5, "text 86", helper_86]
+FUN helper_87(a, b) -> (a * 87 + b) / (87 + 1) - a ^ 2
+VAR value_87 = [87, 87.5, "text 87", helper_87]
+FUN helper_88(a, b) -> (a * 88 + b) / (88 + 1) - a ^ 2
+VAR value_88 = [88, 88.5, "text 88", helper_88]
+FUN helper_89(a, b) -> (a * 89 + b) / (89 + 1) - a ^ 2
+VAR value_89 = [89, 89.5, "text 89", helper_89]
+FUN helper_90(a, b) -> (a * 90 + b) / (90 + 1) - a ^ 2
+VAR value_90 = [90, 90.5, "text 90", helper_90]
+FUN helper_91(a, b) -> (a * 91 + b) / (91 + 1) - a ^ 2
+VAR value_91 = [91, 91.5, "text 91", helper_91]
+FUN helper_92(a, b) -> (a * 92 + b) / (92 + 1) - a ^ 2
+VAR value_92 = [92, 92.5, "text 92", helper_92]
+FUN helper_93(a, b) -> (a * 93 + b) / (93 + 1) - a ^ 2
+VAR value_93 = [93, 93.5, "text 93", helper_93]
+FUN helper_94(a, b) -> (a * 94 + b) / (94 + 1) - a ^ 2
+VAR value_94 = [94, 94.5, "text 94", helper_94]
+FUN helper_95(a, b) -> (a * 95 + b) / (95 + 1) - a ^ 2
+VAR value_95 = [95, 95.5, "text 95", helper_95]
+FUN helper_96(a, b) -> (a * 96 + b) / (96 + 1) - a ^ 2
+VAR value_96 = [96, 96.5, "text 96", helper_96]
+FUN helper_97(a, b) -> (a * 97 + b) / (97 + 1) - a ^ 2
+VAR value_97 = [97, 97.5, "text 97", helper_97]
+FUN helper_98(a, b) -> (a * 98 + b) / (98 + 1) - a ^ 2
+VAR value_98 = [98, 98.5, "text 98", helper_98]
+FUN helper_99(a, b) -> (a * 99 + b) / (99 + 1) - a ^ 2
+VAR value_99 = [99, 99.5, "text 99", helper_99]
+FUN helper_100(a, b) -> (a * 100 + b) / (100 + 1) - a ^ 2
+VAR value_100 = [100, 100.5, "text 100", helper_100]
+FUN helper_101(a, b) -> (a * 101 + b) / (101 + 1) - a ^ 2
+VAR value_101 = [101, 101.5, "text 101", helper_101]
+FUN helper_102(a, b) -> (a * 102 + b) / (102 + 1) - a ^ 2
+VAR value_102 = [102, 102.5, "text 102", helper_102]
+FUN helper_103(a, b) -> (a * 103 + b) / (103 + 1) - a ^ 2
+VAR value_103 = [103, 103.5, "text 103", helper_103]
+FUN helper_104(a, b) -> (a * 104 + b) / (104 + 1) - a ^ 2
+VAR value_104 = [104, 104.5, "text 104", helper_104]
+FUN helper_105(a, b) -> (a * 105 + b) / (105 + 1) - a ^ 2
+VAR value_105 = [105, 105.5, "text 105", helper_105]
+FUN helper_106(a, b) -> (a * 106 + b) / (106 + 1) - a ^ 2
+VAR value_106 = [106, 106.5, "text 106", helper_106]
+FUN helper_107(a, b) -> (a * 107 + b) / (107 + 1) - a ^ 2
+VAR value_107 = [107, 107.5, "text 107", helper_107]
+FUN helper_108(a, b) -> (a * 108 + b) / (108 + 1) - a ^ 2
+VAR value_108 = [108, 108.5, "text 108", helper_108]
+FUN helper_109(a, b) -> (a * 109 + b) / (109 + 1) - a ^ 2
+VAR value_109 = [109, 109.5, "text 109", helper_109]
+FUN helper_110(a, b) -> (a * 110 + b) / (110 + 1) - a ^ 2
+VAR value_110 = [110, 110.5, "text 110", helper_110]
+FUN helper_111(a, b) -> (a * 111 + b) / (111 + 1) - a ^ 2
+VAR value_111 = [111, 111.5, "text 111", helper_111]
+FUN helper_112(a, b) -> (a * 112 + b) / (112 + 1) - a ^ 2
+VAR value_112 = [112, 112.5, "text 112", helper_112]
+FUN helper_113(a, b) -> (a * 113 + b) / (113 + 1) - a ^ 2
+VAR value_113 = [113, 113.5, "text 113", helper_113]
+FUN helper_114(a, b) -> (a * 114 + b) / (114 + 1) - a ^ 2
+VAR value_114 = [114, 114.5, "text 114", helper_114]
+FUN helper_115(a, b) -> (a * 115 + b) / (115 + 1) - a ^ 2
+VAR value_115 = [115, 115.5, "text 115", helper_115]
+FUN helper_116(a, b) -> (a * 116 + b) / (116 + 1) - a ^ 2
+VAR value_116 = [116, 116.5, "text 116", helper_116]
+FUN helper_117(a, b) -> (a * 117 + b) / (117 + 1) - a ^ 2
+VAR value_117 = [117, 117.5, "text 117", helper_117]
+FUN helper_118(a, b) -> (a * 118 + b) / (118 + 1) - a ^ 2
+VAR value_118 = [118, 118.5, "text 118", helper_118]
+FUN helper_119(a, b) -> (a * 119 + b) / (119 + 1) - a ^ 2
+VAR value_119 = [119, 119.5, "text 119", helper_119]
+FUN helper_120(a, b) -> (a * 120 + b) / (120 + 1) - a ^ 2
+VAR value_120 = [120, 120.5, "text 120", helper_120]
+FUN helper_121(a, b) -> (a * 121 + b) / (121 + 1) - a ^ 2
+VAR value_121 = [121, 121.5, "text 121", helper_121]
+FUN helper_122(a, b) -> (a * 122 + b) / (122 + 1) - a ^ 2
+VAR value_122 = [122, 122.5, "text 122", helper_122]
+FUN helper_123(a, b) -> (a * 123 + b) / (123 + 1) - a ^ 2
+VAR value_123 = [123, 123.5, "text 123", helper_123]
+FUN helper_124(a, b) -> (a * 124 + b) / (124 + 1) - a ^ 2
+VAR value_124 = [124, 124.5, "text 124", helper_124]
+FUN helper_125(a, b) -> (a * 125 + b) / (125 + 1) - a ^ 2
+VAR value_125 = [125, 125.5, "text 125", helper_125]
+FUN helper_126(a, b) -> (a * 126 + b) / (126 + 1) - a ^ 2
+VAR value_126 = [126, 126.5, "text 126", helper_126]
+FUN helper_127(a, b) -> (a * 127 + b) / (127 + 1) - a ^ 2
+VAR value_127 = [127, 127.5, "text 127", helper_127]
+FUN helper_128(a, b) -> (a * 128 + b) / (128 + 1) - a ^ 2
+VAR value_128 = [128, 128.5, "text 128", helper_128]
+FUN helper_129(a, b) -> (a * 129 + b) / (129 + 1) - a ^ 2
+VAR value_129 = [129, 129.5, "text 129", helper_129]
+FUN helper_130(a, b) -> (a * 130 + b) / (130 + 1) - a ^ 2
+VAR value_130 = [130, 130.5, "text 130", helper_130]
+FUN helper_131(a, b) -> (a * 131 + b) / (131 + 1) - a ^ 2
+VAR value_131 = [131, 131.5, "text 131", helper_131]
+FUN helper_132(a, b) -> (a * 132 + b) / (132 + 1) - a ^ 2
+VAR value_132 = [132, 132.5, "text 132", helper_132]
+FUN helper_133(a, b) -> (a * 133 + b) / (133 + 1) - a ^ 2
+VAR value_133 = [133, 133.5, "text 133", helper_133]
+FUN helper_134(a, b) -> (a * 134 + b) / (134 + 1) - a ^ 2
+VAR value_134 = [134, 134.5, "text 134", helper_134]
+FUN helper_135(a, b) -> (a * 135 + b) / (135 + 1) - a ^ 2
+VAR value_135 = [135, 135.5, "text 135", helper_135]
+FUN helper_136(a, b) -> (a * 136 + b) / (136 + 1) - a ^ 2
+VAR value_136 = [136, 136.5, "text 136", helper_136]
+FUN helper_137(a, b) -> (a * 137 + b) / (137 + 1) - a ^ 2
+VAR value_137 = [137, 137.5, "text 137", helper_137]
+FUN helper_138(a, b) -> (a * 138 + b) / (138 + 1) - a ^ 2
+VAR value_138 = [138, 138.5, "text 138", helper_138]
+FUN helper_139(a, b) -> (a * 139 + b) / (139 + 1) - a ^ 2
+VAR value_139 = [139, 139.5, "text 139", helper_139]
+FUN helper_140(a, b) -> (a * 140 + b) / (140 + 1) - a ^ 2
+VAR value_140 = [140, 140.5, "text 140", helper_140]
+FUN helper_141(a, b) -> (a * 141 + b) / (141 + 1) - a ^ 2
+VAR value_141 = [141, 141.5, "text 141", helper_141]
+FUN helper_142(a, b) -> (a * 142 + b) / (142 + 1) - a ^ 2
+VAR value_142 = [142, 142.5, "text 142", helper_142]
+FUN helper_143(a, b) -> (a * 143 + b) / (143 + 1) - a ^ 2
+VAR value_143 = [143, 143.5, "text 143", helper_143]
+FUN helper_144(a, b) -> (a * 144 + b) / (144 + 1) - a ^ 2
+VAR value_144 = [144, 144.5, "text 144", helper_144]
+FUN helper_145(a, b) -> (a * 145 + b) / (145 + 1) - a ^ 2
+VAR value_145 = [145, 145.5, "text 145", helper_145]
+FUN helper_146(a, b) -> (a * 146 + b) / (146 + 1) - a ^ 2
+VAR value_146 = [146, 146.5, "text 146", helper_146]
+FUN helper_147(a, b) -> (a * 147 + b) / (147 + 1) - a ^ 2
+VAR value_147 = [147, 147.5, "text 147", helper_147]
+FUN helper_148(a, b) -> (a * 148 + b) / (148 + 1) - a ^ 2
+VAR value_148 = [148, 148.5, "text 148", helper_148]
+FUN helper_149(a, b) -> (a * 149 + b) / (149 + 1) - a ^ 2
+VAR value_149 = [149, 149.5, "text 149", helper_149]
+FUN helper_150(a, b) -> (a * 150 + b) / (150 + 1) - a ^ 2
+VAR value_150 = [150, 150.5, "text 150", helper_150]
+FUN helper_151(a, b) -> (a * 151 + b) / (151 + 1) - a ^ 2
+VAR value_151 = [151, 151.5, "text 151", helper_151]
+FUN helper_152(a, b) -> (a * 152 + b) / (152 + 1) - a ^ 2
+VAR value_152 = [152, 152.5, "text 152", helper_152]
+FUN helper_153(a, b) -> (a * 153 + b) / (153 + 1) - a ^ 2
+VAR value_153 = [153, 153.5, "text 153", helper_153]
+FUN helper_154(a, b) -> (a * 154 + b) / (154 + 1) - a ^ 2
+VAR value_154 = [154, 154.5, "text 154", helper_154]
+FUN helper_155(a, b) -> (a * 155 + b) / (155 + 1) - a ^ 2
+VAR value_155 = [155, 155.5, "text 155", helper_155]
+FUN helper_156(a, b) -> (a * 156 + b) / (156 + 1) - a ^ 2
+VAR value_156 = [156, 156.5, "text 156", helper_156]
+FUN helper_157(a, b) -> (a * 157 + b) / (157 + 1) - a ^ 2
+VAR value_157 = [157, 157.5, "text 157", helper_157]
+FUN helper_158(a, b) -> (a * 158 + b) / (158 + 1) - a ^ 2
+VAR value_158 = [158, 158.5, "text 158", helper_158]
+FUN helper_159(a, b) -> (a * 159 + b) / (159 + 1) - a ^ 2
+VAR value_159 = [159, 159.5, "text 159", helper_159]
+FUN helper_160(a, b) -> (a * 160 + b) / (160 + 1) - a ^ 2
+VAR value_160 = [160, 160.5, "text 160", helper_160]
+FUN helper_161(a, b) -> (a * 161 + b) / (161 + 1) - a ^ 2
+VAR value_161 = [161, 161.5, "text 161", helper_161]
+FUN helper_162(a, b) -> (a * 162 + b) / (162 + 1) - a ^ 2
+VAR value_162 = [162, 162.5, "text 162", helper_162]
+FUN helper_163(a, b) -> (a * 163 + b) / (163 + 1) - a ^ 2
+VAR value_163 = [163, 163.5, "text 163", helper_163]
+FUN helper_164(a, b) -> (a * 164 + b) / (164 + 1) - a ^ 2
+VAR value_164 = [164, 164.5, "text 164", helper_164]
+FUN helper_165(a, b) -> (a * 165 + b) / (165 + 1) - a ^ 2
+VAR value_165 = [165, 165.5, "text 165", helper_165]
+FUN helper_166(a, b) -> (a * 166 + b) / (166 + 1) - a ^ 2
+VAR value_166 = [166, 166.5, "text 166", helper_166]
+FUN helper_167(a, b) -> (a * 167 + b) / (167 + 1) - a ^ 2
+VAR value_167 = [167, 167.5, "text 167", helper_167]
+FUN helper_168(a, b) -> (a * 168 + b) / (168 + 1) - a ^ 2
+VAR value_168 = [168, 168.5, "text 168", helper_168]
+FUN helper_169(a, b) -> (a * 169 + b) / (169 + 1) - a ^ 2
+VAR value_169 = [169, 169.5, "text 169", helper_169]
+FUN helper_170(a, b) -> (a * 170 + b) / (170 + 1) - a ^ 2
+VAR value_170 = [170, 170.5, "text 170", helper_170]
+FUN helper_171(a, b) -> (a * 171 + b) / (171 + 1) - a ^ 2
+VAR value_171 = [171, 171.5, "text 171", helper_171]
+FUN helper_172(a, b) -> (a * 172 + b) / (172 + 1) - a ^ 2
+VAR value_172 = [172, 172.5, "text 172", helper_172]
+FUN helper_173(a, b) -> (a * 173 + b) / (173 + 1) - a ^ 2
+VAR value_173 = [173, 173.5, "text 173", helper_173]
+FUN helper_174(a, b) -> (a * 174 + b) / (174 + 1) - a ^ 2
+VAR value_174 = [174, 174.5, "text 174", helper_174]
+FUN helper_175(a, b) -> (a * 175 + b) / (175 + 1) - a ^ 2
+VAR value_175 = [175, 175.5, "text 175", helper_175]
+FUN helper_176(a, b) -> (a * 176 + b) / (176 + 1) - a ^ 2
+VAR value_176 = [176, 176.5, "text 176", helper_176]
+FUN helper_177(a, b) -> (a * 177 + b) / (177 + 1) - a ^ 2
+VAR value_177 = [177, 177.5, "text 177", helper_177]
+FUN helper_178(a, b) -> (a * 178 + b) / (178 + 1) - a ^ 2
+VAR value_178 = [178, 178.5, "text 178", helper_178]
+FUN helper_179(a, b) -> (a * 179 + b) / (179 + 1) - a ^ 2
+VAR value_179 = [179, 179.5, "text 179", helper_179]
+FUN helper_180(a, b) -> (a * 180 + b) / (180 + 1) - a ^ 2
+VAR value_180 = [180, 180.5, "text 180", helper_180]
+FUN helper_181(a, b) -> (a * 181 + b) / (181 + 1) - a ^ 2
+VAR value_181 = [181, 181.5, "text 181", helper_181]
+FUN helper_182(a, b) -> (a * 182 + b) / (182 + 1) - a ^ 2
+VAR value_182 = [182, 182.5, "text 182", helper_182]
+FUN helper_183(a, b) -> (a * 183 + b) / (183 + 1) - a ^ 2
+VAR value_183 = [183, 183.5, "text 183", helper_183]
+FUN helper_184(a, b) -> (a * 184 + b) / (184 + 1) - a ^ 2
+VAR value_184 = [184, 184.5, "text 184", helper_184]
+FUN helper_185(a, b) -> (a * 185 + b) / (185 + 1) - a ^ 2
+VAR value_185 = [185, 185.5, "text 185", helper_185]
+FUN helper_186(a, b) -> (a * 186 + b) / (186 + 1) - a ^ 2
+VAR value_186 = [186, 186.5, "text 186", helper_186]
+FUN helper_187(a, b) -> (a * 187 + b) / (187 + 1) - a ^ 2
+VAR value_187 = [187, 187.5, "text 187", helper_187]
+FUN helper_188(a, b) -> (a * 188 + b) / (188 + 1) - a ^ 2
+VAR value_188 = [188, 188.5, "text 188", helper_188]
+FUN helper_189(a, b) -> (a * 189 + b) / (189 + 1) - a ^ 2
+VAR value_189 = [189, 189.5, "text 189", helper_189]
+FUN helper_190(a, b) -> (a * 190 + b) / (190 + 1) - a ^ 2
+VAR value_190 = [190, 190.5, "text 190", helper_190]
+FUN helper_191(a, b) -> (a * 191 + b) / (191 + 1) - a ^ 2
+VAR value_191 = [191, 191.5, "text 191", helper_191]
+FUN helper_192(a, b) -> (a * 192 + b) / (192 + 1) - a ^ 2
+VAR value_192 = [192, 192.5, "text 192", helper_192]
+FUN helper_193(a, b) -> (a * 193 + b) / (193 + 1) - a ^ 2
+VAR value_193 = [193, 193.5, "text 193", helper_193]
+FUN helper_194(a, b) -> (a * 194 + b) / (194 + 1) - a ^ 2
+VAR value_194 = [194, 194.5, "text 194", helper_194]
+FUN helper_195(a, b) -> (a * 195 + b) / (195 + 1) - a ^ 2
+VAR value_195 = [195, 195.5, "text 195", helper_195]
+FUN helper_196(a, b) -> (a * 196 + b) / (196 + 1) - a ^ 2
+VAR value_196 = [196, 196.5, "text 196", helper_196]
+FUN helper_197(a, b) -> (a * 197 + b) / (197 + 1) - a ^ 2
+VAR value_197 = [197, 197.5, "text 197", helper_197]
+FUN helper_198(a, b) -> (a * 198 + b) / (198 + 1) - a ^ 2
+VAR value_198 = [198, 198.5, "text 198", helper_198]
+FUN helper_199(a, b) -> (a * 199 + b) / (199 + 1) - a ^ 2
+VAR value_199 = [199, 199.5, "text 199", helper_199]
+FUN helper_200(a, b) -> (a * 200 + b) / (200 + 1) - a ^ 2
+VAR value_200 = [200, 200.5, "text 200", helper_200]
+FUN helper_201(a, b) -> (a * 201 + b) / (201 + 1) - a ^ 2
+VAR value_201 = [201, 201.5, "text 201", helper_201]
+FUN helper_202(a, b) -> (a * 202 + b) / (202 + 1) - a ^ 2
+VAR value_202 = [202, 202.5, "text 202", helper_202]
+FUN helper_203(a, b) -> (a * 203 + b) / (203 + 1) - a ^ 2
+VAR value_203 = [203, 203.5, "text 203", helper_203]
+FUN helper_204(a, b) -> (a * 204 + b) / (204 + 1) - a ^ 2
+VAR value_204 = [204, 204.5, "text 204", helper_204]
+FUN helper_205(a, b) -> (a * 205 + b) / (205 + 1) - a ^ 2
+VAR value_205 = [205, 205.5, "text 205", helper_205]
+FUN helper_206(a, b) -> (a * 206 + b) / (206 + 1) - a ^ 2
+VAR value_206 = [206, 206.5, "text 206", helper_206]
+FUN helper_207(a, b) -> (a * 207 + b) / (207 + 1) - a ^ 2
+VAR value_207 = [207, 207.5, "text 207", helper_207]
+FUN helper_208(a, b) -> (a * 208 + b) / (208 + 1) - a ^ 2
+VAR value_208 = [208, 208.5, "text 208", helper_208]
+FUN helper_209(a, b) -> (a * 209 + b) / (209 + 1) - a ^ 2
+VAR value_209 = [209, 209.5, "text 209", helper_209]
+FUN helper_210(a, b) -> (a * 210 + b) / (210 + 1) - a ^ 2
+VAR value_210 = [210, 210.5, "text 210", helper_210]
+FUN helper_211(a, b) -> (a * 211 + b) / (211 + 1) - a ^ 2
+VAR value_211 = [211, 211.5, "text 211", helper_211]
+FUN helper_212(a, b) -> (a * 212 + b) / (212 + 1) - a ^ 2
+VAR value_212 = [212, 212.5, "text 212", helper_212]
+FUN helper_213(a, b) -> (a * 213 + b) / (213 + 1) - a ^ 2
+VAR value_213 = [213, 213.5, "text 213", helper_213]
+FUN helper_214(a, b) -> (a * 214 + b) / (214 + 1) - a ^ 2
+VAR value_214 = [214, 214.5, "text 214", helper_214]
+FUN helper_215(a, b) -> (a * 215 + b) / (215 + 1) - a ^ 2
+VAR value_215 = [215, 215.5, "text 215", helper_215]
+FUN helper_216(a, b) -> (a * 216 + b) / (216 + 1) - a ^ 2
+VAR value_216 = [216, 216.5, "text 216", helper_216]
+FUN helper_217(a, b) -> (a * 217 + b) / (217 + 1) - a ^ 2
+VAR value_217 = [217, 217.5, "text 217", helper_217]
+FUN helper_218(a, b) -> (a * 218 + b) / (218 + 1) - a ^ 2
+VAR value_218 = [218, 218.5, "text 218", helper_218]
+FUN helper_219(a, b) -> (a * 219 + b) / (219 + 1) - a ^ 2
+VAR value_219 = [219, 219.5, "text 219", helper_219]
+FUN helper_220(a, b) -> (a * 220 + b) / (220 + 1) - a ^ 2
+VAR value_220 = [220, 220.5, "text 220", helper_220]
+FUN helper_221(a, b) -> (a * 221 + b) / (221 + 1) - a ^ 2
+VAR value_221 = [221, 221.5, "text 221", helper_221]
+FUN helper_222(a, b) -> (a * 222 + b) / (222 + 1) - a ^ 2
+VAR value_222 = [222, 222.5, "text 222", helper_222]
+FUN helper_223(a, b) -> (a * 223 + b) / (223 + 1) - a ^ 2
+VAR value_223 = [223, 223.5, "text 223", helper_223]
+FUN helper_224(a, b) -> (a * 224 + b) / (224 + 1) - a ^ 2
+VAR value_224 = [224, 224.5, "text 224", helper_224]
+FUN helper_225(a, b) -> (a * 225 + b) / (225 + 1) - a ^ 2
+VAR value_225 = [225, 225.5, "text 225", helper_225]
+FUN helper_226(a, b) -> (a * 226 + b) / (226 + 1) - a ^ 2
+VAR value_226 = [226, 226.5, "text 226", helper_226]
+FUN helper_227(a, b) -> (a * 227 + b) / (227 + 1) - a ^ 2
+VAR value_227 = [227, 227.5, "text 227", helper_227]
+FUN helper_228(a, b) -> (a * 228 + b) / (228 + 1) - a ^ 2
+VAR value_228 = [228, 228.5, "text 228", helper_228]
+FUN helper_229(a, b) -> (a * 229 + b) / (229 + 1) - a ^ 2
+VAR value_229 = [229, 229.5, "text 229", helper_229]
+FUN helper_230(a, b) -> (a * 230 + b) / (230 + 1) - a ^ 2
+VAR value_230 = [230, 230.5, "text 230", helper_230]
+FUN helper_231(a, b) -> (a * 231 + b) / (231 + 1) - a ^ 2
+VAR value_231 = [231, 231.5, "text 231", helper_231]
+FUN helper_232(a, b) -> (a * 232 + b) / (232 + 1) - a ^ 2
+VAR value_232 = [232, 232.5, "text 232", helper_232]
+FUN helper_233(a, b) -> (a * 233 + b) / (233 + 1) - a ^ 2
+VAR value_233 = [233, 233.5, "text 233", helper_233]
+FUN helper_234(a, b) -> (a * 234 + b) / (234 + 1) - a ^ 2
+VAR value_234 = [234, 234.5, "text 234", helper_234]
+FUN helper_235(a, b) -> (a * 235 + b) / (235 + 1) - a ^ 2
+VAR value_235 = [235, 235.5, "text 235", helper_235]
+FUN helper_236(a, b) -> (a * 236 + b) / (236 + 1) - a ^ 2
+VAR value_236 = [236, 236.5, "text 236", helper_236]
+FUN helper_237(a, b) -> (a * 237 + b) / (237 + 1) - a ^ 2
+VAR value_237 = [237, 237.5, "text 237", helper_237]
+FUN helper_238(a, b) -> (a * 238 + b) / (238 + 1) - a ^ 2
+VAR value_238 = [238, 238.5, "text 238", helper_238]
+FUN helper_239(a, b) -> (a * 239 + b) / (239 + 1) - a ^ 2
+VAR value_239 = [239, 239.5, "text 239", helper_239]
+FUN helper_240(a, b) -> (a * 240 + b) / (240 + 1) - a ^ 2
+VAR value_240 = [240, 240.5, "text 240", helper_240]
+FUN helper_241(a, b) -> (a * 241 + b) / (241 + 1) - a ^ 2
+VAR value_241 = [241, 241.5, "text 241", helper_241]
+FUN helper_242(a, b) -> (a * 242 + b) / (242 + 1) - a ^ 2
+VAR value_242 = [242, 242.5, "text 242", helper_242]
+FUN helper_243(a, b) -> (a * 243 + b) / (243 + 1) - a ^ 2
+VAR value_243 = [243, 243.5, "text 243", helper_243]
+FUN helper_244(a, b) -> (a * 244 + b) / (244 + 1) - a ^ 2
+VAR value_244 = [244, 244.5, "text 244", helper_244]
+FUN helper_245(a, b) -> (a * 245 + b) / (245 + 1) - a ^ 2
+VAR value_245 = [245, 245.5, "text 245", helper_245]
+FUN helper_246(a, b) -> (a * 246 + b) / (246 + 1) - a ^ 2
+VAR value_246 = [246, 246.5, "text 246", helper_246]
+FUN helper_247(a, b) -> (a * 247 + b) / (247 + 1) - a ^ 2
+VAR value_247 = [247, 247.5, "text 247", helper_247]
+FUN helper_248(a, b) -> (a * 248 + b) / (248 + 1) - a ^ 2
+VAR value_248 = [248, 248.5, "text 248", helper_248]
+FUN helper_249(a, b) -> (a * 249 + b) / (249 + 1) - a ^ 2
+VAR value_249 = [249, 249.5, "text 249", helper_249]
+FUN helper_250(a, b) -> (a * 250 + b) / (250 + 1) - a ^ 2
+VAR value_250 = [250, 250.5, "text 250", helper_250]
+FUN helper_251(a, b) -> (a * 251 + b) / (251 + 1) - a ^ 2
+VAR value_251 = [251, 251.5, "text 251", helper_251]
+FUN helper_252(a, b) -> (a * 252 + b) / (252 + 1) - a ^ 2
+VAR value_252 = [252, 252.5, "text 252", helper_252]
+FUN helper_253(a, b) -> (a * 253 + b) / (253 + 1) - a ^ 2
+VAR value_253 = [253, 253.5, "text 253", helper_253]
+FUN helper_254(a, b) -> (a * 254 + b) / (254 + 1) - a ^ 2
+VAR value_254 = [254, 254.5, "text 254", helper_254]
+FUN helper_255(a, b) -> (a * 255 + b) / (255 + 1) - a ^ 2
+VAR value_255 = [255, 255.5, "text 255", helper_255]
+FUN helper_256(a, b) -> (a * 256 + b) / (256 + 1) - a ^ 2
+VAR value_256 = [256, 256.5, "text 256", helper_256]
+FUN helper_257(a, b) -> (a * 257 + b) / (257 + 1) - a ^ 2
+VAR value_257 = [257, 257.5, "text 257", helper_257]
+FUN helper_258(a, b) -> (a * 258 + b) / (258 + 1) - a ^ 2
+VAR value_258 = [258, 258.5, "text 258", helper_258]
+FUN helper_259(a, b) -> (a * 259 + b) / (259 + 1) - a ^ 2
+VAR value_259 = [259, 259.5, "text 259", helper_259]
+FUN helper_260(a, b) -> (a * 260 + b) / (260 + 1) - a ^ 2
+VAR value_260 = [260, 260.5, "text 260", helper_260]
+FUN helper_261(a, b) -> (a * 261 + b) / (261 + 1) - a ^ 2
+VAR value_261 = [261, 261.5, "text 261", helper_261]
+FUN helper_262(a, b) -> (a * 262 + b) / (262 + 1) - a ^ 2
+VAR value_262 = [262, 262.5, "text 262", helper_262]
+FUN helper_263(a, b) -> (a * 263 + b) / (263 + 1) - a ^ 2
+VAR value_263 = [263, 263.5, "text 263", helper_263]
+FUN helper_264(a, b) -> (a * 264 + b) / (264 + 1) - a ^ 2
+VAR value_264 = [264, 264.5, "text 264", helper_264]
+FUN helper_265(a, b) -> (a * 265 + b) / (265 + 1) - a ^ 2
+VAR value_265 = [265, 265.5, "text 265", helper_265]
+FUN helper_266(a, b) -> (a * 266 + b) / (266 + 1) - a ^ 2
+VAR value_266 = [266, 266.5, "text 266", helper_266]
+FUN helper_267(a, b) -> (a * 267 + b) / (267 + 1) - a ^ 2
+VAR value_267 = [267, 267.5, "text 267", helper_267]
+FUN helper_268(a, b) -> (a * 268 + b) / (268 + 1) - a ^ 2
+VAR value_268 = [268, 268.5, "text 268", helper_268]
+FUN helper_269(a, b) -> (a * 269 + b) / (269 + 1) - a ^ 2
+VAR value_269 = [269, 269.5, "text 269", helper_269]
+FUN helper_270(a, b) -> (a * 270 + b) / (270 + 1) - a ^ 2
+VAR value_270 = [270, 270.5, "text 270", helper_270]
+FUN helper_271(a, b) -> (a * 271 + b) / (271 + 1) - a ^ 2
+VAR value_271 = [271, 271.5, "text 271", helper_271]
+FUN helper_272(a, b) -> (a * 272 + b) / (272 + 1) - a ^ 2
+VAR value_272 = [272, 272.5, "text 272", helper_272]
+FUN helper_273(a, b) -> (a * 273 + b) / (273 + 1) - a ^ 2
+VAR value_273 = [273, 273.5, "text 273", helper_273]
+FUN helper_274(a, b) -> (a * 274 + b) / (274 + 1) - a ^ 2
+VAR value_274 = [274, 274.5, "text 274", helper_274]
+FUN helper_275(a, b) -> (a * 275 + b) / (275 + 1) - a ^ 2
+VAR value_275 = [275, 275.5, "text 275", helper_275]
+FUN helper_276(a, b) -> (a * 276 + b) / (276 + 1) - a ^ 2
+VAR value_276 = [276, 276.5, "text 276", helper_276]
+FUN helper_277(a, b) -> (a * 277 + b) / (277 + 1) - a ^ 2
+VAR value_277 = [277, 277.5, "text 277", helper_277]
+FUN helper_278(a, b) -> (a * 278 + b) / (278 + 1) - a ^ 2
+VAR value_278 = [278, 278.5, "text 278", helper_278]
+FUN helper_279(a, b) -> (a * 279 + b) / (279 + 1) - a ^ 2
+VAR value_279 = [279, 279.5, "text 279", helper_279]
+FUN helper_280(a, b) -> (a * 280 + b) / (280 + 1) - a ^ 2
+VAR value_280 = [280, 280.5, "text 280", helper_280]
+FUN helper_281(a, b) -> (a * 281 + b) / (281 + 1) - a ^ 2
+VAR value_281 = [281, 281.5, "text 281", helper_281]
+FUN helper_282(a, b) -> (a * 282 + b) / (282 + 1) - a ^ 2
+VAR value_282 = [282, 282.5, "text 282", helper_282]
+FUN helper_283(a, b) -> (a * 283 + b) / (283 + 1) - a ^ 2
+VAR value_283 = [283, 283.5, "text 283", helper_283]
+FUN helper_284(a, b) -> (a * 284 + b) / (284 + 1) - a ^ 2
+VAR value_284 = [284, 284.5, "text 284", helper_284]
+FUN helper_285(a, b) -> (a * 285 + b) / (285 + 1) - a ^ 2
+VAR value_285 = [285, 285.5, "text 285", helper_285]
+FUN helper_286(a, b) -> (a * 286 + b) / (286 + 1) - a ^ 2
+VAR value_286 = [286, 286.5, "text 286", helper_286]
+FUN helper_287(a, b) -> (a * 287 + b) / (287 + 1) - a ^ 2
+VAR value_287 = [287, 287.5, "text 287", helper_287]
+FUN helper_288(a, b) -> (a * 288 + b) / (288 + 1) - a ^ 2
+VAR value_288 = [288, 288.5, "text 288", helper_288]
+FUN helper_289(a, b) -> (a * 289 + b) / (289 + 1) - a ^ 2
+VAR value_289 = [289, 289.5, "text 289", helper_289]
+FUN helper_290(a, b) -> (a * 290 + b) / (290 + 1) - a ^ 2
+VAR value_290 = [290, 290.5, "text 290", helper_290]
+FUN helper_291(a, b) -> (a * 291 + b) / (291 + 1) - a ^ 2
+VAR value_291 = [291, 291.5, "text 291", helper_291]
+FUN helper_292(a, b) -> (a * 292 + b) / (292 + 1) - a ^ 2
+VAR value_292 = [292, 292.5, "text 292", helper_292]
+FUN helper_293(a, b) -> (a * 293 + b) / (293 + 1) - a ^ 2
+VAR value_293 = [293, 293.5, "text 293", helper_293]
+FUN helper_294(a, b) -> (a * 294 + b) / (294 + 1) - a ^ 2
+VAR value_294 = [294, 294.5, "text 294", helper_294]
+FUN helper_295(a, b) -> (a * 295 + b) / (295 + 1) - a ^ 2
+VAR value_295 = [295, 295.5, "text 295", helper_295]
+FUN helper_296(a, b) -> (a * 296 + b) / (296 + 1) - a ^ 2
+VAR value_296 = [296, 296.5, "text 296", helper_296]
+FUN helper_297(a, b) -> (a * 297 + b) / (297 + 1) - a ^ 2
+VAR value_297 = [297, 297.5, "text 297", helper_297]
+FUN helper_298(a, b) -> (a * 298 + b) / (298 + 1) - a ^ 2
+VAR value_298 = [298, 298.5, "text 298", helper_298]
+FUN helper_299(a, b) -> (a * 299 + b) / (299 + 1) - a ^ 2
+VAR value_299 = [299, 299.5, "text 299", helper_299]
+FUN helper_300(a, b) -> (a * 300 + b) / (300 + 1) - a ^ 2
+VAR value_300 = [300, 300.5, "text 300", helper_300]
+FUN helper_301(a, b) -> (a * 301 + b) / (301 + 1) - a ^ 2
+VAR value_301 = [301, 301.5, "text 301", helper_301]
+FUN helper_302(a, b) -> (a * 302 + b) / (302 + 1) - a ^ 2
+VAR value_302 = [302, 302.5, "text 302", helper_302]
+FUN helper_303(a, b) -> (a * 303 + b) / (303 + 1) - a ^ 2
+VAR value_303 = [303, 303.5, "text 303", helper_303]
+FUN helper_304(a, b) -> (a * 304 + b) / (304 + 1) - a ^ 2
+VAR value_304 = [304, 304.5, "text 304", helper_304]
+FUN helper_305(a, b) -> (a * 305 + b) / (305 + 1) - a ^ 2
+VAR value_305 = [305, 305.5, "text 305", helper_305]
+FUN helper_306(a, b) -> (a * 306 + b) / (306 + 1) - a ^ 2
+VAR value_306 = [306, 306.5, "text 306", helper_306]
+FUN helper_307(a, b) -> (a * 307 + b) / (307 + 1) - a ^ 2
+VAR value_307 = [307, 307.5, "text 307", helper_307]
+FUN helper_308(a, b) -> (a * 308 + b) / (308 + 1) - a ^ 2
+VAR value_308 = [308, 308.5, "text 308", helper_308]
+FUN helper_309(a, b) -> (a * 309 + b) / (309 + 1) - a ^ 2
+VAR value_309 = [309, 309.5, "text 309", helper_309]
+FUN helper_310(a, b) -> (a * 310 + b) / (310 + 1) - a ^ 2
+VAR value_310 = [310, 310.5, "text 310", helper_310]
+FUN helper_311(a, b) -> (a * 311 + b) / (311 + 1) - a ^ 2
+VAR value_311 = [311, 311.5, "text 311", helper_311]
+FUN helper_312(a, b) -> (a * 312 + b) / (312 + 1) - a ^ 2
+VAR value_312 = [312, 312.5, "text 312", helper_312]
+FUN helper_313(a, b) -> (a * 313 + b) / (313 + 1) - a ^ 2
+VAR value_313 = [313, 313.5, "text 313", helper_313]
+FUN helper_314(a, b) -> (a * 314 + b) / (314 + 1) - a ^ 2
+VAR value_314 = [314, 314.5, "text 314", helper_314]
+FUN helper_315(a, b) -> (a * 315 + b) / (315 + 1) - a ^ 2
+VAR value_315 = [315, 315.5, "text 315", helper_315]
+FUN helper_316(a, b) -> (a * 316 + b) / (316 + 1) - a ^ 2
+VAR value_316 = [316, 316.5, "text 316", helper_316]
+FUN helper_317(a, b) -> (a * 317 + b) / (317 + 1) - a ^ 2
+VAR value_317 = [317, 317.5, "text 317", helper_317]
+FUN helper_318(a, b) -> (a * 318 + b) / (318 + 1) - a ^ 2
+VAR value_318 = [318, 318.5, "text 318", helper_318]
+FUN helper_319(a, b) -> (a * 319 + b) / (319 + 1) - a ^ 2
+VAR value_319 = [319, 319.5, "text 319", helper_319]
+FUN helper_320(a, b) -> (a * 320 + b) / (320 + 1) - a ^ 2
+VAR value_320 = [320, 320.5, "text 320", helper_320]
+FUN helper_321(a, b) -> (a * 321 + b) / (321 + 1) - a ^ 2
+VAR value_321 = [321, 321.5, "text 321", helper_321]
+FUN helper_322(a, b) -> (a * 322 + b) / (322 + 1) - a ^ 2
+VAR value_322 = [322, 322.5, "text 322", helper_322]
+FUN helper_323(a, b) -> (a * 323 + b) / (323 + 1) - a ^ 2
+VAR value_323 = [323, 323.5, "text 323", helper_323]
+FUN helper_324(a, b) -> (a * 324 + b) / (324 + 1) - a ^ 2
+VAR value_324 = [324, 324.5, "text 324", helper_324]
+FUN helper_325(a, b) -> (a * 325 + b) / (325 + 1) - a ^ 2
+VAR value_325 = [325, 325.5, "text 325", helper_325]
+FUN helper_326(a, b) -> (a * 326 + b) / (326 + 1) - a ^ 2
+VAR value_326 = [326, 326.5, "text 326", helper_326]
+FUN helper_327(a, b) -> (a * 327 + b) / (327 + 1) - a ^ 2
+VAR value_327 = [327, 327.5, "text 327", helper_327]
+FUN helper_328(a, b) -> (a * 328 + b) / (328 + 1) - a ^ 2
+VAR value_328 = [328, 328.5, "text 328", helper_328]
+FUN helper_329(a, b) -> (a * 329 + b) / (329 + 1) - a ^ 2
+VAR value_329 = [329, 329.5, "text 329", helper_329]
+FUN helper_330(a, b) -> (a * 330 + b) / (330 + 1) - a ^ 2
+VAR value_330 = [330, 330.5, "text 330", helper_330]
+FUN helper_331(a, b) -> (a * 331 + b) / (331 + 1) - a ^ 2
+VAR value_331 = [331, 331.5, "text 331", helper_331]
+FUN helper_332(a, b) -> (a * 332 + b) / (332 + 1) - a ^ 2
+VAR value_332 = [332, 332.5, "text 332", helper_332]
+FUN helper_333(a, b) -> (a * 333 + b) / (333 + 1) - a ^ 2
+VAR value_333 = [333, 333.5, "text 333", helper_333]
+FUN helper_334(a, b) -> (a * 334 + b) / (334 + 1) - a ^ 2
+VAR value_334 = [334, 334.5, "text 334", helper_334]
+FUN helper_335(a, b) -> (a * 335 + b) / (335 + 1) - a ^ 2
+VAR value_335 = [335, 335.5, "text 335", helper_335]
+FUN helper_336(a, b) -> (a * 336 + b) / (336 + 1) - a ^ 2
+VAR value_336 = [336, 336.5, "text 336", helper_336]
+FUN helper_337(a, b) -> (a * 337 + b) / (337 + 1) - a ^ 2
+VAR value_337 = [337, 337.5, "text 337", helper_337]
+FUN helper_338(a, b) -> (a * 338 + b) / (338 + 1) - a ^ 2
+VAR value_338 = [338, 338.5, "text 338", helper_338]
+FUN helper_339(a, b) -> (a * 339 + b) / (339 + 1) - a ^ 2
+VAR value_339 = [339, 339.5, "text 339", helper_339]
+FUN helper_340(a, b) -> (a * 340 + b) / (340 + 1) - a ^ 2
+VAR value_340 = [340, 340.5, "text 340", helper_340]
+FUN helper_341(a, b) -> (a * 341 + b) / (341 + 1) - a ^ 2
+VAR value_341 = [341, 341.5, "text 341", helper_341]
+FUN helper_342(a, b) -> (a * 342 + b) / (342 + 1) - a ^ 2
+VAR value_342 = [342, 342.5, "text 342", helper_342]
+FUN helper_343(a, b) -> (a * 343 + b) / (343 + 1) - a ^ 2
+VAR value_343 = [343, 343.5, "text 343", helper_343]
+FUN helper_344(a, b) -> (a * 344 + b) / (344 + 1) - a ^ 2
+VAR value_344 = [344, 344.5, "text 344", helper_344]
+FUN helper_345(a, b) -> (a * 345 + b) / (345 + 1) - a ^ 2
+VAR value_345 = [345, 345.5, "text 345", helper_345]
+FUN helper_346(a, b) -> (a * 346 + b) / (346 + 1) - a ^ 2
+VAR value_346 = [346, 346.5, "text 346", helper_346]
+FUN helper_347(a, b) -> (a * 347 + b) / (347 + 1) - a ^ 2
+VAR value_347 = [347, 347.5, "text 347", helper_347]
+FUN helper_348(a, b) -> (a * 348 + b) / (348 + 1) - a ^ 2
+VAR value_348 = [348, 348.5, "text 348", helper_348]
+FUN helper_349(a, b) -> (a * 349 + b) / (349 + 1) - a ^ 2
+VAR value_349 = [349, 349.5, "text 349", helper_349]
+FUN helper_350(a, b) -> (a * 350 + b) / (350 + 1) - a ^ 2
+VAR value_350 = [350, 350.5, "text 350", helper_350]
+FUN helper_351(a, b) -> (a * 351 + b) / (351 + 1) - a ^ 2
+VAR value_351 = [351, 351.5, "text 351", helper_351]
+FUN helper_352(a, b) -> (a * 352 + b) / (352 + 1) - a ^ 2
+VAR value_352 = [352, 352.5, "text 352", helper_352]
+FUN helper_353(a, b) -> (a * 353 + b) / (353 + 1) - a ^ 2
+VAR value_353 = [353, 353.5, "text 353", helper_353]
+FUN helper_354(a, b) -> (a * 354 + b) / (354 + 1) - a ^ 2
+VAR value_354 = [354, 354.5, "text 354", helper_354]
+FUN helper_355(a, b) -> (a * 355 + b) / (355 + 1) - a ^ 2
+VAR value_355 = [355, 355.5, "text 355", helper_355]
+FUN helper_356(a, b) -> (a * 356 + b) / (356 + 1) - a ^ 2
+VAR value_356 = [356, 356.5, "text 356", helper_356]
+FUN helper_357(a, b) -> (a * 357 + b) / (357 + 1) - a ^ 2
+VAR value_357 = [357, 357.5, "text 357", helper_357]
+FUN helper_358(a, b) -> (a * 358 + b) / (358 + 1) - a ^ 2
+VAR value_358 = [358, 358.5, "text 358", helper_358]
+FUN helper_359(a, b) -> (a * 359 + b) / (359 + 1) - a ^ 2
+VAR value_359 = [359, 359.5, "text 359", helper_359]
+FUN helper_360(a, b) -> (a * 360 + b) / (360 + 1) - a ^ 2
+VAR value_360 = [360, 360.5, "text 360", helper_360]
+FUN helper_361(a, b) -> (a * 361 + b) / (361 + 1) - a ^ 2
+VAR value_361 = [361, 361.5, "text 361", helper_361]
+FUN helper_362(a, b) -> (a * 362 + b) / (362 + 1) - a ^ 2
+VAR value_362 = [362, 362.5, "text 362", helper_362]
+FUN helper_363(a, b) -> (a * 363 + b) / (363 + 1) - a ^ 2
+VAR value_363 = [363, 363.5, "text 363", helper_363]
+FUN helper_364(a, b) -> (a * 364 + b) / (364 + 1) - a ^ 2
+VAR value_364 = [364, 364.5, "text 364", helper_364]
+FUN helper_365(a, b) -> (a * 365 + b) / (365 + 1) - a ^ 2
+VAR value_365 = [365, 365.5, "text 365", helper_365]
+FUN helper_366(a, b) -> (a * 366 + b) / (366 + 1) - a ^ 2
+VAR value_366 = [366, 366.5, "text 366", helper_366]
+FUN helper_367(a, b) -> (a * 367 + b) / (367 + 1) - a ^ 2
+VAR value_367 = [367, 367.5, "text 367", helper_367]
+FUN helper_368(a, b) -> (a * 368 + b) / (368 + 1) - a ^ 2
+VAR value_368 = [368, 368.5, "text 368", helper_368]
+FUN helper_369(a, b) -> (a * 369 + b) / (369 + 1) - a ^ 2
+VAR value_369 = [369, 369.5, "text 369", helper_369]
+FUN helper_370(a, b) -> (a * 370 + b) / (370 + 1) - a ^ 2
+VAR value_370 = [370, 370.5, "text 370", helper_370]
+FUN helper_371(a, b) -> (a * 371 + b) / (371 + 1) - a ^ 2
+VAR value_371 = [371, 371.5, "text 371", helper_371]
+FUN helper_372(a, b) -> (a * 372 + b) / (372 + 1) - a ^ 2
+VAR value_372 = [372, 372.5, "text 372", helper_372]
+FUN helper_373(a, b) -> (a * 373 + b) / (373 + 1) - a ^ 2
+VAR value_373 = [373, 373.5, "text 373", helper_373]
+FUN helper_374(a, b) -> (a * 374 + b) / (374 + 1) - a ^ 2
+VAR value_374 = [374, 374.5, "text 374", helper_374]
+FUN helper_375(a, b) -> (a * 375 + b) / (375 + 1) - a ^ 2
+VAR value_375 = [375, 375.5, "text 375", helper_375]
+FUN helper_376(a, b) -> (a * 376 + b) / (376 + 1) - a ^ 2
+VAR value_376 = [376, 376.5, "text 376", helper_376]
+FUN helper_377(a, b) -> (a * 377 + b) / (377 + 1) - a ^ 2
+VAR value_377 = [377, 377.5, "text 377", helper_377]
+FUN helper_378(a, b) -> (a * 378 + b) / (378 + 1) - a ^ 2
+VAR value_378 = [378, 378.5, "text 378", helper_378]
+FUN helper_379(a, b) -> (a * 379 + b) / (379 + 1) - a ^ 2
+VAR value_379 = [379, 379.5, "text 379", helper_379]
+FUN helper_380(a, b) -> (a * 380 + b) / (380 + 1) - a ^ 2
+VAR value_380 = [380, 380.5, "text 380", helper_380]
+FUN helper_381(a, b) -> (a * 381 + b) / (381 + 1) - a ^ 2
+VAR value_381 = [381, 381.5, "text 381", helper_381]
+FUN helper_382(a, b) -> (a * 382 + b) / (382 + 1) - a ^ 2
+VAR value_382 = [382, 382.5, "text 382", helper_382]
+FUN helper_383(a, b) -> (a * 383 + b) / (383 + 1) - a ^ 2
+VAR value_383 = [383, 383.5, "text 383", helper_383]
+FUN helper_384(a, b) -> (a * 384 + b) / (384 + 1) - a ^ 2
+VAR value_384 = [384, 384.5, "text 384", helper_384]
+FUN helper_385(a, b) -> (a * 385 + b) / (385 + 1) - a ^ 2
+VAR value_385 = [385, 385.5, "text 385", helper_385]
+FUN helper_386(a, b) -> (a * 386 + b) / (386 + 1) - a ^ 2
+VAR value_386 = [386, 386.5, "text 386", helper_386]
+FUN helper_387(a, b) -> (a * 387 + b) / (387 + 1) - a ^ 2
+VAR value_387 = [387, 387.5, "text 387", helper_387]
+FUN helper_388(a, b) -> (a * 388 + b) / (388 + 1) - a ^ 2
+VAR value_388 = [388, 388.5, "text 388", helper_388]
+FUN helper_389(a, b) -> (a * 389 + b) / (389 + 1) - a ^ 2
+VAR value_389 = [389, 389.5, "text 389", helper_389]
+FUN helper_390(a, b) -> (a * 390 + b) / (390 + 1) - a ^ 2
+VAR value_390 = [390, 390.5, "text 390", helper_390]
+FUN helper_391(a, b) -> (a * 391 + b) / (391 + 1) - a ^ 2
+VAR value_391 = [391, 391.5, "text 391", helper_391]
+FUN helper_392(a, b) -> (a * 392 + b) / (392 + 1) - a ^ 2
+VAR value_392 = [392, 392.5, "text 392", helper_392]
+FUN helper_393(a, b) -> (a * 393 + b) / (393 + 1) - a ^ 2
+VAR value_393 = [393, 393.5, "text 393", helper_393]
+FUN helper_394(a, b) -> (a * 394 + b) / (394 + 1) - a ^ 2
+VAR value_394 = [394, 394.5, "text 394", helper_394]
+FUN helper_395(a, b) -> (a * 395 + b) / (395 + 1) - a ^ 2
+VAR value_395 = [395, 395.5, "text 395", helper_395]
+FUN helper_396(a, b) -> (a * 396 + b) / (396 + 1) - a ^ 2
+VAR value_396 = [396, 396.5, "text 396", helper_396]
+FUN helper_397(a, b) -> (a * 397 + b) / (397 + 1) - a ^ 2
+VAR value_397 = [397, 397.5, "text 397", helper_397]
+FUN helper_398(a, b) -> (a * 398 + b) / (398 + 1) - a ^ 2
+VAR value_398 = [398, 398.5, "text 398", helper_398]
+FUN helper_399(a, b) -> (a * 399 + b) / (399 + 1) - a ^ 2
+VAR value_399 = [399, 399.5, "text 399", helper_399]
+FUN helper_400(a, b) -> (a * 400 + b) / (400 + 1) - a ^ 2
+VAR value_400 = [400, 400.5, "text 400", helper_400]
+FUN helper_401(a, b) -> (a * 401 + b) / (401 + 1) - a ^ 2
+VAR value_401 = [401, 401.5, "text 401", helper_401]
+FUN helper_402(a, b) -> (a * 402 + b) / (402 + 1) - a ^ 2
+VAR value_402 = [402, 402.5, "text 402", helper_402]
+FUN helper_403(a, b) -> (a * 403 + b) / (403 + 1) - a ^ 2
+VAR value_403 = [403, 403.5, "text 403", helper_403]
+FUN helper_404(a, b) -> (a * 404 + b) / (404 + 1) - a ^ 2
+VAR value_404 = [404, 404.5, "text 404", helper_404]
+FUN helper_405(a, b) -> (a * 405 + b) / (405 + 1) - a ^ 2
+VAR value_405 = [405, 405.5, "text 405", helper_405]
+FUN helper_406(a, b) -> (a * 406 + b) / (406 + 1) - a ^ 2
+VAR value_406 = [406, 406.5, "text 406", helper_406]
+FUN helper_407(a, b) -> (a * 407 + b) / (407 + 1) - a ^ 2
+VAR value_407 = [407, 407.5, "text 407", helper_407]
+FUN helper_408(a, b) -> (a * 408 + b) / (408 + 1) - a ^ 2
+VAR value_408 = [408, 408.5, "text 408", helper_408]
+FUN helper_409(a, b) -> (a * 409 + b) / (409 + 1) - a ^ 2
+VAR value_409 = [409, 409.5, "text 409", helper_409]
+FUN helper_410(a, b) -> (a * 410 + b) / (410 + 1) - a ^ 2
+VAR value_410 = [410, 410.5, "text 410", helper_410]
+FUN helper_411(a, b) -> (a * 411 + b) / (411 + 1) - a ^ 2
+VAR value_411 = [411, 411.5, "text 411", helper_411]
+FUN helper_412(a, b) -> (a * 412 + b) / (412 + 1) - a ^ 2
+VAR value_412 = [412, 412.5, "text 412", helper_412]
+FUN helper_413(a, b) -> (a * 413 + b) / (413 + 1) - a ^ 2
+VAR value_413 = [413, 413.5, "text 413", helper_413]
+FUN helper_414(a, b) -> (a * 414 + b) / (414 + 1) - a ^ 2
+VAR value_414 = [414, 414.5, "text 414", helper_414]
+FUN helper_415(a, b) -> (a * 415 + b) / (415 + 1) - a ^ 2
+VAR value_415 = [415, 415.5, "text 415", helper_415]
+FUN helper_416(a, b) -> (a * 416 + b) / (416 + 1) - a ^ 2
+VAR value_416 = [416, 416.5, "text 416", helper_416]
+FUN helper_417(a, b) -> (a * 417 + b) / (417 + 1) - a ^ 2
+VAR value_417 = [417, 417.5, "text 417", helper_417]
+FUN helper_418(a, b) -> (a * 418 + b) / (418 + 1) - a ^ 2
+VAR value_418 = [418, 418.5, "text 418", helper_418]
+FUN helper_419(a, b) -> (a * 419 + b) / (419 + 1) - a ^ 2
+VAR value_419 = [419, 419.5, "text 419", helper_419]
+FUN helper_420(a, b) -> (a * 420 + b) / (420 + 1) - a ^ 2
+VAR value_420 = [420, 420.5, "text 420", helper_420]
+FUN helper_421(a, b) -> (a * 421 + b) / (421 + 1) - a ^ 2
+VAR value_421 = [421, 421.5, "text 421", helper_421]
+FUN helper_422(a, b) -> (a * 422 + b) / (422 + 1) - a ^ 2
+VAR value_422 = [422, 422.5, "text 422", helper_422]
+FUN helper_423(a, b) -> (a * 423 + b) / (423 + 1) - a ^ 2
+VAR value_423 = [423, 423.5, "text 423", helper_423]
+FUN helper_424(a, b) -> (a * 424 + b) / (424 + 1) - a ^ 2
+VAR value_424 = [424, 424.5, "text 424", helper_424]
+FUN helper_425(a, b) -> (a * 425 + b) / (425 + 1) - a ^ 2
+VAR value_425 = [425, 425.5, "text 425", helper_425]
+FUN helper_426(a, b) -> (a * 426 + b) / (426 + 1) - a ^ 2
+VAR value_426 = [426, 426.5, "text 426", helper_426]
+FUN helper_427(a, b) -> (a * 427 + b) / (427 + 1) - a ^ 2
+VAR value_427 = [427, 427.5, "text 427", helper_427]
+FUN helper_428(a, b) -> (a * 428 + b) / (428 + 1) - a ^ 2
+VAR value_428 = [428, 428.5, "text 428", helper_428]
+FUN helper_429(a, b) -> (a * 429 + b) / (429 + 1) - a ^ 2
+VAR value_429 = [429, 429.5, "text 429", helper_429]
+FUN helper_430(a, b) -> (a * 430 + b) / (430 + 1) - a ^ 2
+VAR value_430 = [430, 430.5, "text 430", helper_430]
+FUN helper_431(a, b) -> (a * 431 + b) / (431 + 1) - a ^ 2
+VAR value_431 = [431, 431.5, "text 431", helper_431]
+FUN helper_432(a, b) -> (a * 432 + b) / (432 + 1) - a ^ 2
+VAR value_432 = [432, 432.5, "text 432", helper_432]
+FUN helper_433(a, b) -> (a * 433 + b) / (433 + 1) - a ^ 2
+VAR value_433 = [433, 433.5, "text 433", helper_433]
+FUN helper_434(a, b) -> (a * 434 + b) / (434 + 1) - a ^ 2
+VAR value_434 = [434, 434.5, "text 434", helper_434]
+FUN helper_435(a, b) -> (a * 435 + b) / (435 + 1) - a ^ 2
+VAR value_435 = [435, 435.5, "text 435", helper_435]
+FUN helper_436(a, b) -> (a * 436 + b) / (436 + 1) - a ^ 2
+VAR value_436 = [436, 436.5, "text 436", helper_436]
+FUN helper_437(a, b) -> (a * 437 + b) / (437 + 1) - a ^ 2
+VAR value_437 = [437, 437.5, "text 437", helper_437]
+FUN helper_438(a, b) -> (a * 438 + b) / (438 + 1) - a ^ 2
+VAR value_438 = [438, 438.5, "text 438", helper_438]
+FUN helper_439(a, b) -> (a * 439 + b) / (439 + 1) - a ^ 2
+VAR value_439 = [439, 439.5, "text 439", helper_439]
+FUN helper_440(a, b) -> (a * 440 + b) / (440 + 1) - a ^ 2
+VAR value_440 = [440, 440.5, "text 440", helper_440]
+FUN helper_441(a, b) -> (a * 441 + b) / (441 + 1) - a ^ 2
+VAR value_441 = [441, 441.5, "text 441", helper_441]
+FUN helper_442(a, b) -> (a * 442 + b) / (442 + 1) - a ^ 2
+VAR value_442 = [442, 442.5, "text 442", helper_442]
+FUN helper_443(a, b) -> (a * 443 + b) / (443 + 1) - a ^ 2
+VAR value_443 = [443, 443.5, "text 443", helper_443]
+FUN helper_444(a, b) -> (a * 444 + b) / (444 + 1) - a ^ 2
+VAR value_444 = [444, 444.5, "text 444", helper_444]
+FUN helper_445(a, b) -> (a * 445 + b) / (445 + 1) - a ^ 2
+VAR value_445 = [445, 445.5, "text 445", helper_445]
+FUN helper_446(a, b) -> (a * 446 + b) / (446 + 1) - a ^ 2
+VAR value_446 = [446, 446.5, "text 446", helper_446]
+FUN helper_447(a, b) -> (a * 447 + b) / (447 + 1) - a ^ 2
+VAR value_447 = [447, 447.5, "text 447", helper_447]
+FUN helper_448(a, b) -> (a * 448 + b) / (448 + 1) - a ^ 2
+VAR value_448 = [448, 448.5, "text 448", helper_448]
+FUN helper_449(a, b) -> (a * 449 + b) / (449 + 1) - a ^ 2
+VAR value_449 = [449, 449.5, "text 449", helper_449]
+FUN helper_450(a, b) -> (a * 450 + b) / (450 + 1) - a ^ 2
+VAR value_450 = [450, 450.5, "text 450", helper_450]
+FUN helper_451(a, b) -> (a * 451 + b) / (451 + 1) - a ^ 2
+VAR value_451 = [451, 451.5, "text 451", helper_451]
+FUN helper_452(a, b) -> (a * 452 + b) / (452 + 1) - a ^ 2
+VAR value_452 = [452, 452.5, "text 452", helper_452]
+FUN helper_453(a, b) -> (a * 453 + b) / (453 + 1) - a ^ 2
+VAR value_453 = [453, 453.5, "text 453", helper_453]
+FUN helper_454(a, b) -> (a * 454 + b) / (454 + 1) - a ^ 2
+VAR value_454 = [454, 454.5, "text 454", helper_454]
+FUN helper_455(a, b) -> (a * 455 + b) / (455 + 1) - a ^ 2
+VAR value_455 = [455, 455.5, "text 455", helper_455]
+FUN helper_456(a, b) -> (a * 456 + b) / (456 + 1) - a ^ 2
+VAR value_456 = [456, 456.5, "text 456", helper_456]
+FUN helper_457(a, b) -> (a * 457 + b) / (457 + 1) - a ^ 2
+VAR value_457 = [457, 457.5, "text 457", helper_457]
+FUN helper_458(a, b) -> (a * 458 + b) / (458 + 1) - a ^ 2
+VAR value_458 = [458, 458.5, "text 458", helper_458]
+FUN helper_459(a, b) -> (a * 459 + b) / (459 + 1) - a ^ 2
+VAR value_459 = [459, 459.5, "text 459", helper_459]
+FUN helper_460(a, b) -> (a * 460 + b) / (460 + 1) - a ^ 2
+VAR value_460 = [460, 460.5, "text 460", helper_460]
+FUN helper_461(a, b) -> (a * 461 + b) / (461 + 1) - a ^ 2
+VAR value_461 = [461, 461.5, "text 461", helper_461]
+FUN helper_462(a, b) -> (a * 462 + b) / (462 + 1) - a ^ 2
+VAR value_462 = [462, 462.5, "text 462", helper_462]
+FUN helper_463(a, b) -> (a * 463 + b) / (463 + 1) - a ^ 2
+VAR value_463 = [463, 463.5, "text 463", helper_463]
+FUN helper_464(a, b) -> (a * 464 + b) / (464 + 1) - a ^ 2
+VAR value_464 = [464, 464.5, "text 464", helper_464]
+FUN helper_465(a, b) -> (a * 465 + b) / (465 + 1) - a ^ 2
+VAR value_465 = [465, 465.5, "text 465", helper_465]
+FUN helper_466(a, b) -> (a * 466 + b) / (466 + 1) - a ^ 2
+VAR value_466 = [466, 466.5, "text 466", helper_466]
+FUN helper_467(a, b) -> (a * 467 + b) / (467 + 1) - a ^ 2
+VAR value_467 = [467, 467.5, "text 467", helper_467]
+FUN helper_468(a, b) -> (a * 468 + b) / (468 + 1) - a ^ 2
+VAR value_468 = [468, 468.5, "text 468", helper_468]
+FUN helper_469(a, b) -> (a * 469 + b) / (469 + 1) - a ^ 2
+VAR value_469 = [469, 469.5, "text 469", helper_469]
+FUN helper_470(a, b) -> (a * 470 + b) / (470 + 1) - a ^ 2
+VAR value_470 = [470, 470.5, "text 470", helper_470]
+FUN helper_471(a, b) -> (a * 471 + b) / (471 + 1) - a ^ 2
+VAR value_471 = [471, 471.5, "text 471", helper_471]
+FUN helper_472(a, b) -> (a * 472 + b) / (472 + 1) - a ^ 2
+VAR value_472 = [472, 472.5, "text 472", helper_472]
+FUN helper_473(a, b) -> (a * 473 + b) / (473 + 1) - a ^ 2
+VAR value_473 = [473, 473.5, "text 473", helper_473]
+FUN helper_474(a, b) -> (a * 474 + b) / (474 + 1) - a ^ 2
+VAR value_474 = [474, 474.5, "text 474", helper_474]
+FUN helper_475(a, b) -> (a * 475 + b) / (475 + 1) - a ^ 2
+VAR value_475 = [475, 475.5, "text 475", helper_475]
+FUN helper_476(a, b) -> (a * 476 + b) / (476 + 1) - a ^ 2
+VAR value_476 = [476, 476.5, "text 476", helper_476]
+FUN helper_477(a, b) -> (a * 477 + b) / (477 + 1) - a ^ 2
+VAR value_477 = [477, 477.5, "text 477", helper_477]
+FUN helper_478(a, b) -> (a * 478 + b) / (478 + 1) - a ^ 2
+VAR value_478 = [478, 478.5, "text 478", helper_478]
+FUN helper_479(a, b) -> (a * 479 + b) / (479 + 1) - a ^ 2
+VAR value_479 = [479, 479.5, "text 479", helper_479]
+FUN helper_480(a, b) -> (a * 480 + b) / (480 + 1) - a ^ 2
+VAR value_480 = [480, 480.5, "text 480", helper_480]
+FUN helper_481(a, b) -> (a * 481 + b) / (481 + 1) - a ^ 2
+VAR value_481 = [481, 481.5, "text 481", helper_481]
+FUN helper_482(a, b) -> (a * 482 + b) / (482 + 1) - a ^ 2
+VAR value_482 = [482, 482.5, "text 482", helper_482]
+FUN helper_483(a, b) -> (a * 483 + b) / (483 + 1) - a ^ 2
+VAR value_483 = [483, 483.5, "text 483", helper_483]
+FUN helper_484(a, b) -> (a * 484 + b) / (484 + 1) - a ^ 2
+VAR value_484 = [484, 484.5, "text 484", helper_484]
+FUN helper_485(a, b) -> (a * 485 + b) / (485 + 1) - a ^ 2
+VAR value_485 = [485, 485.5, "text 485", helper_485]
+FUN helper_486(a, b) -> (a * 486 + b) / (486 + 1) - a ^ 2
+VAR value_486 = [486, 486.5, "text 486", helper_486]
+FUN helper_487(a, b) -> (a * 487 + b) / (487 + 1) - a ^ 2
+VAR value_487 = [487, 487.5, "text 487", helper_487]
+FUN helper_488(a, b) -> (a * 488 + b) / (488 + 1) - a ^ 2
+VAR value_488 = [488, 488.5, "text 488", helper_488]
+FUN helper_489(a, b) -> (a * 489 + b) / (489 + 1) - a ^ 2
+VAR value_489 = [489, 489.5, "text 489", helper_489]
+FUN helper_490(a, b) -> (a * 490 + b) / (490 + 1) - a ^ 2
+VAR value_490 = [490, 490.5, "text 490", helper_490]
+FUN helper_491(a, b) -> (a * 491 + b) / (491 + 1) - a ^ 2
+VAR value_491 = [491, 491.5, "text 491", helper_491]
+FUN helper_492(a, b) -> (a * 492 + b) / (492 + 1) - a ^ 2
+VAR value_492 = [492, 492.5, "text 492", helper_492]
+FUN helper_493(a, b) -> (a * 493 + b) / (493 + 1) - a ^ 2
+VAR value_493 = [493, 493.5, "text 493", helper_493]
+FUN helper_494(a, b) -> (a * 494 + b) / (494 + 1) - a ^ 2
+VAR value_494 = [494, 494.5, "text 494", helper_494]
+FUN helper_495(a, b) -> (a * 495 + b) / (495 + 1) - a ^ 2
+VAR value_495 = [495, 495.5, "text 495", helper_495]
+FUN helper_496(a, b) -> (a * 496 + b) / (496 + 1) - a ^ 2
+VAR value_496 = [496, 496.5, "text 496", helper_496]
+FUN helper_497(a, b) -> (a * 497 + b) / (497 + 1) - a ^ 2
+VAR value_497 = [497, 497.5, "text 497", helper_497]
+FUN helper_498(a, b) -> (a * 498 + b) / (498 + 1) - a ^ 2
+VAR value_498 = [498, 498.5, "text 498", helper_498]
+FUN helper_499(a, b) -> (a * 499 + b) / (499 + 1) - a ^ 2
+VAR value_499 = [499, 499.5, "text 499", helper_499]
+helper_499(1, 2)
@@ -0,0 +1,3 @@
+VAR items = []
+FOR i = 0 TO 5000 THEN APPEND(items, i)
+FOR i = 4999 TO -1 STEP -1 THEN POP(items, i)
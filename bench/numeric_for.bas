@@ -0,0 +1,3 @@
+VAR total = 0
+FOR i = 0 TO 20000 THEN VAR total = total + i * 2 - 1
+FOR i = 20000 TO 0 STEP -2 THEN VAR total = total - i / 2
@@ -0,0 +1,3 @@
+VAR text = ""
+VAR i = 0
+WHILE (VAR i = i + 1) <= 2000 THEN VAR text = text + "ab"
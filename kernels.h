@@ -0,0 +1,141 @@
+#pragma once
+
+#include "basic.h"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+// Operator kernels: one small function per (left kind, right kind, opcode)
+// that computes a binary operation straight from its operands, without the
+// std::pair<Number, Error> and copies of Number::added_to and friends.
+// The tables are built at compile time from the templates below; a null
+// entry means the combination has no kernel and takes the generic path in
+// visit_BinOpNode, which also reports every error.
+
+enum class OperandKind : uint8_t { Number, String, List, Other, count };
+
+const size_t operand_kinds = static_cast<size_t>(OperandKind::count);
+const size_t opcodes = static_cast<size_t>(Opcode::count);
+
+inline OperandKind operand_kind(const Node* node) {
+    if (dynamic_cast<const Number*>(node) != nullptr) return OperandKind::Number;
+    if (dynamic_cast<const String*>(node) != nullptr) return OperandKind::String;
+    if (dynamic_cast<const List*>(node) != nullptr) return OperandKind::List;
+    return OperandKind::Other;
+}
+
+////////////////////////////
+////// NUMBER KERNELS //////
+////////////////////////////
+
+// What the Number methods compute. False for a division by zero.
+template <Opcode op>
+inline bool number_kernel(double left, double right, double& result) {
+    if constexpr (op == Opcode::Add) result = left + right;
+    else if constexpr (op == Opcode::Sub) result = left - right;
+    else if constexpr (op == Opcode::Mul) result = left * right;
+    else if constexpr (op == Opcode::Div) {
+        if (right == 0) return false;
+        result = left / right;
+    }
+    else if constexpr (op == Opcode::Pow) result = std::pow(left, right);
+    else if constexpr (op == Opcode::Eq) result = double(left == right);
+    else if constexpr (op == Opcode::Ne) result = double(left != right);
+    else if constexpr (op == Opcode::Lt) result = double(left < right);
+    else if constexpr (op == Opcode::Gt) result = double(left > right);
+    else if constexpr (op == Opcode::Lte) result = double(left <= right);
+    else if constexpr (op == Opcode::Gte) result = double(left >= right);
+    else if constexpr (op == Opcode::And) result = double(left && right);
+    else if constexpr (op == Opcode::Or) result = double(left || right);
+    return true;
+}
+
+typedef bool (*NumberKernel)(double left, double right, double& result);
+
+template <size_t... I>
+constexpr std::array<NumberKernel, sizeof...(I)> make_number_kernels(std::index_sequence<I...>) {
+    return { { &number_kernel<static_cast<Opcode>(I)>... } };
+}
+
+// Indexed by Opcode
+constexpr std::array<NumberKernel, opcodes> number_kernels = make_number_kernels(std::make_index_sequence<opcodes>());
+
+////////////////////////////
+////// OPERAND KERNELS /////
+////////////////////////////
+
+// A kernel's value: a Number when is_string is false, else a String.
+// bytes_left is set by the caller from InterpreterInstance::bytes_left.
+struct KernelResult
+{
+    bool is_string = false;
+    double number = 0;
+    std::string string;
+    size_t bytes_left = SIZE_MAX;
+};
+
+// Size of value repeated count times, as String::multed_by repeats it
+inline double repeated_size(const std::string& value, double count) {
+    return count > 0 ? double(value.size()) * std::ceil(count) : 0;
+}
+
+// Operands are of the kinds the kernel is filed under
+typedef bool (*Kernel)(const Node* left, const Node* right, KernelResult& result);
+
+template <OperandKind left, OperandKind right, Opcode op>
+struct KernelFor
+{
+    static constexpr Kernel kernel = nullptr;
+};
+
+template <Opcode op>
+struct KernelFor<OperandKind::Number, OperandKind::Number, op>
+{
+    static bool run(const Node* left, const Node* right, KernelResult& result) {
+        return number_kernel<op>(static_cast<const Number*>(left)->value, static_cast<const Number*>(right)->value, result.number);
+    }
+    static constexpr Kernel kernel = &run;
+};
+
+template <>
+struct KernelFor<OperandKind::String, OperandKind::String, Opcode::Add>
+{
+    static bool run(const Node* left, const Node* right, KernelResult& result) {
+        result.is_string = true;
+        result.string = static_cast<const String*>(left)->value + static_cast<const String*>(right)->value;
+        return true;
+    }
+    static constexpr Kernel kernel = &run;
+};
+
+template <>
+struct KernelFor<OperandKind::String, OperandKind::Number, Opcode::Mul>
+{
+    // Repeats as often as String::multed_by does. Leaves a result too large
+    // for the memory limit to the generic path, which reports it.
+    static bool run(const Node* left, const Node* right, KernelResult& result) {
+        const std::string& value = static_cast<const String*>(left)->value;
+        double count = static_cast<const Number*>(right)->value;
+        if (repeated_size(value, count) > double(result.bytes_left)) return false;
+        result.is_string = true;
+        for (double i = 0; i < count; ++i) result.string += value;
+        return true;
+    }
+    static constexpr Kernel kernel = &run;
+};
+
+template <size_t... I>
+constexpr std::array<Kernel, sizeof...(I)> make_kernels(std::index_sequence<I...>) {
+    return { { KernelFor<
+        static_cast<OperandKind>(I / (operand_kinds * opcodes)),
+        static_cast<OperandKind>(I / opcodes % operand_kinds),
+        static_cast<Opcode>(I % opcodes)>::kernel... } };
+}
+
+constexpr std::array<Kernel, operand_kinds * operand_kinds * opcodes> kernels = make_kernels(std::make_index_sequence<operand_kinds * operand_kinds * opcodes>());
+
+inline Kernel find_kernel(OperandKind left, OperandKind right, Opcode op) {
+    if (op == Opcode::count) return nullptr;
+    return kernels[(static_cast<size_t>(left) * operand_kinds + static_cast<size_t>(right)) * opcodes + static_cast<size_t>(op)];
+}
@@ -0,0 +1,108 @@
+#include "output_sink.h"
+#include <iostream>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+OutputSink::OutputSink(int fd, size_t capacity)
+    : capacity(capacity), fd(fd), unbuffered(false) {
+    buffer.reserve(capacity);
+}
+
+OutputSink::~OutputSink() {
+    flush();
+}
+
+void OutputSink::write(std::string_view data) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (unbuffered) {
+        write_all(data.data(), data.size());
+        return;
+    }
+
+    if (buffer.size() + data.size() > capacity) {
+        write_all(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+
+    // Anything that would not fit even in an empty buffer skips the copy
+    if (data.size() >= capacity) write_all(data.data(), data.size());
+    else buffer.append(data.data(), data.size());
+}
+
+void OutputSink::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    write_all(buffer.data(), buffer.size());
+    buffer.clear();
+}
+
+void OutputSink::set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->capacity = capacity;
+    if (buffer.size() >= capacity) {
+        write_all(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+    buffer.reserve(capacity);
+}
+
+void OutputSink::set_unbuffered(bool unbuffered) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (unbuffered) {
+        write_all(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+    this->unbuffered = unbuffered;
+}
+
+void OutputSink::set_fd(int fd) {
+    std::lock_guard<std::mutex> lock(mutex);
+    write_all(buffer.data(), buffer.size());
+    buffer.clear();
+    this->fd = fd;
+}
+
+// Hands everything flushed from now on to writer instead of the file
+// descriptor, e.g. to frame it for a socket. An empty writer restores the fd.
+void OutputSink::set_writer(std::function<void(std::string_view)> writer) {
+    std::lock_guard<std::mutex> lock(mutex);
+    write_all(buffer.data(), buffer.size());
+    buffer.clear();
+    this->writer = writer;
+}
+
+bool OutputSink::is_unbuffered() const {
+    return unbuffered;
+}
+
+void OutputSink::write_all(const char* data, size_t size) {
+    if (size == 0) return;
+
+    if (writer) {
+        writer(std::string_view(data, size));
+        return;
+    }
+
+    // Whatever already went through std::cout has to come out first
+    std::cout.flush();
+
+    while (size > 0) {
+#ifdef _WIN32
+        int written = _write(fd, data, static_cast<unsigned int>(size));
+        if (written <= 0) return;
+#else
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+#endif
+        data += written;
+        size -= written;
+    }
+}
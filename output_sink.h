@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+// Collects program output (PRINT and friends) and hands it to the OS in bulk
+// with write(2) once the buffer fills up, on an explicit flush, or at the end
+// of the program. In unbuffered mode every write goes straight out.
+class OutputSink
+{
+public:
+    OutputSink(int fd = 1, size_t capacity = 64 * 1024);
+    ~OutputSink();
+
+    OutputSink(const OutputSink&) = delete;
+    OutputSink& operator=(const OutputSink&) = delete;
+
+    void write(std::string_view data);
+    void flush();
+
+    void set_capacity(size_t capacity);
+    void set_unbuffered(bool unbuffered);
+    void set_fd(int fd);
+    void set_writer(std::function<void(std::string_view)> writer);
+    bool is_unbuffered() const;
+
+private:
+    void write_all(const char* data, size_t size);
+
+    std::string buffer;
+    size_t capacity;
+    int fd;
+    bool unbuffered;
+    std::function<void(std::string_view)> writer; // replaces fd when set
+    std::mutex mutex;
+};
@@ -0,0 +1,726 @@
+#include "passes.h"
+#include "basic.h"
+#include "kernels.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <set>
+#include <sstream>
+
+////////////////////////////
+/////// VOID CONTEXT ///////
+////////////////////////////
+
+void mark_void_context(std::shared_ptr<Node> node, bool is_void) {
+    if (node == nullptr) return;
+    std::string class_name = node->get_class_name();
+
+    if (class_name == "ListNode") {
+        std::shared_ptr<ListNode> list = std::dynamic_pointer_cast<ListNode>(node);
+        for (size_t i = 0; i < list->element_nodes.size(); i++) {
+            bool is_last = i + 1 == list->element_nodes.size();
+            mark_void_context(list->element_nodes[i], list->is_block && (is_void || !is_last));
+        }
+    }
+    else if (class_name == "ForNode") {
+        std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+        for_node->is_void = is_void;
+        mark_void_context(for_node->start_value_node);
+        mark_void_context(for_node->end_value_node);
+        mark_void_context(for_node->step_value_node);
+        mark_void_context(for_node->body_node, is_void);
+    }
+    else if (class_name == "WhileNode") {
+        std::shared_ptr<WhileNode> while_node = std::dynamic_pointer_cast<WhileNode>(node);
+        while_node->is_void = is_void;
+        mark_void_context(while_node->condition_node);
+        mark_void_context(while_node->body_node, is_void);
+    }
+    else if (class_name == "IfNode") {
+        std::shared_ptr<IfNode> if_node = std::dynamic_pointer_cast<IfNode>(node);
+        for (auto& case_ : if_node->cases) {
+            mark_void_context(case_[0]);
+            for (size_t i = 1; i < case_.size(); i++) mark_void_context(case_[i], is_void);
+        }
+        mark_void_context(if_node->else_case, is_void);
+    }
+    else if (class_name == "BinOpNode") {
+        mark_void_context(std::dynamic_pointer_cast<BinOpNode>(node)->left_node);
+        mark_void_context(std::dynamic_pointer_cast<BinOpNode>(node)->right_node);
+    }
+    else if (class_name == "UnaryOpNode") {
+        mark_void_context(std::dynamic_pointer_cast<UnaryOpNode>(node)->node);
+    }
+    else if (class_name == "VarAssignNode") {
+        mark_void_context(std::dynamic_pointer_cast<VarAssignNode>(node)->value_node);
+    }
+    else if (class_name == "FuncDefNode") {
+        // The body is the function's return value
+        mark_void_context(std::dynamic_pointer_cast<FuncDefNode>(node)->body_node);
+    }
+    else if (class_name == "CallNode") {
+        mark_void_context(std::dynamic_pointer_cast<CallNode>(node)->node_to_call);
+        for (auto arg : std::dynamic_pointer_cast<CallNode>(node)->arg_nodes) mark_void_context(arg);
+    }
+}
+
+////////////////////////////
+///// CONSTANT FOLDING /////
+////////////////////////////
+
+// Longer strings are built at run time, where they count against the memory limit
+static const size_t max_folded_string = 1024;
+
+// Pointers to the child slots of node, so that a pass can replace children
+static std::vector<std::shared_ptr<Node>*> child_slots(std::shared_ptr<Node> node) {
+    std::vector<std::shared_ptr<Node>*> slots;
+    std::string class_name = node->get_class_name();
+
+    if (class_name == "ListNode") {
+        for (auto& element : std::dynamic_pointer_cast<ListNode>(node)->element_nodes) slots.push_back(&element);
+    }
+    else if (class_name == "VarAssignNode") {
+        slots.push_back(&std::dynamic_pointer_cast<VarAssignNode>(node)->value_node);
+    }
+    else if (class_name == "BinOpNode") {
+        slots.push_back(&std::dynamic_pointer_cast<BinOpNode>(node)->left_node);
+        slots.push_back(&std::dynamic_pointer_cast<BinOpNode>(node)->right_node);
+    }
+    else if (class_name == "UnaryOpNode") {
+        slots.push_back(&std::dynamic_pointer_cast<UnaryOpNode>(node)->node);
+    }
+    else if (class_name == "IfNode") {
+        std::shared_ptr<IfNode> if_node = std::dynamic_pointer_cast<IfNode>(node);
+        for (auto& case_ : if_node->cases) {
+            for (auto& part : case_) slots.push_back(&part);
+        }
+        slots.push_back(&if_node->else_case);
+    }
+    else if (class_name == "ForNode") {
+        std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+        slots.push_back(&for_node->start_value_node);
+        slots.push_back(&for_node->end_value_node);
+        slots.push_back(&for_node->step_value_node);
+        slots.push_back(&for_node->body_node);
+    }
+    else if (class_name == "WhileNode") {
+        slots.push_back(&std::dynamic_pointer_cast<WhileNode>(node)->condition_node);
+        slots.push_back(&std::dynamic_pointer_cast<WhileNode>(node)->body_node);
+    }
+    else if (class_name == "FuncDefNode") {
+        slots.push_back(&std::dynamic_pointer_cast<FuncDefNode>(node)->body_node);
+    }
+    else if (class_name == "CallNode") {
+        std::shared_ptr<CallNode> call = std::dynamic_pointer_cast<CallNode>(node);
+        slots.push_back(&call->node_to_call);
+        for (auto& arg : call->arg_nodes) slots.push_back(&arg);
+    }
+    else if (class_name == "CachedNode") {
+        slots.push_back(&std::dynamic_pointer_cast<CachedNode>(node)->expr_node);
+    }
+    return slots;
+}
+
+// Every name the program binds: VAR targets, loop variables, function names
+// and parameters
+static void collect_assigned(std::shared_ptr<Node> node, std::set<std::string>& names) {
+    if (node == nullptr) return;
+    std::string class_name = node->get_class_name();
+
+    if (class_name == "VarAssignNode") names.insert(std::dynamic_pointer_cast<VarAssignNode>(node)->var_name_tok.text);
+    else if (class_name == "ForNode") names.insert(std::dynamic_pointer_cast<ForNode>(node)->var_name_tok.text);
+    else if (class_name == "FuncDefNode") {
+        std::shared_ptr<FuncDefNode> func_def = std::dynamic_pointer_cast<FuncDefNode>(node);
+        names.insert(func_def->var_name_tok.text);
+        for (auto& arg_name_tok : func_def->arg_name_toks) names.insert(arg_name_tok.text);
+    }
+
+    for (auto slot : child_slots(node)) collect_assigned(*slot, names);
+}
+
+static std::shared_ptr<Node> number_node(double value, Position pos_start, Position pos_end) {
+    return std::make_shared<NumberNode>(Token(std::trunc(value) == value ? TT_INT : TT_FLOAT, value, "", pos_start, pos_end));
+}
+
+static bool is_number_node(std::shared_ptr<Node> node, double value) {
+    return node->get_class_name() == "NumberNode" && std::dynamic_pointer_cast<NumberNode>(node)->tok.value == value;
+}
+
+// Whether node always evaluates to a Number: the left operand decides which
+// operations a BinOpNode uses
+static bool is_numeric(std::shared_ptr<Node> node) {
+    std::string class_name = node->get_class_name();
+    if (class_name == "NumberNode") return true;
+    if (class_name == "UnaryOpNode") return is_numeric(std::dynamic_pointer_cast<UnaryOpNode>(node)->node);
+    if (class_name == "BinOpNode") return is_numeric(std::dynamic_pointer_cast<BinOpNode>(node)->left_node);
+    return false;
+}
+
+// Whether node always evaluates to 0 or 1
+static bool is_boolean(std::shared_ptr<Node> node) {
+    std::string class_name = node->get_class_name();
+    if (class_name == "NumberNode") return is_number_node(node, 0) || is_number_node(node, 1);
+    if (class_name == "UnaryOpNode") {
+        std::shared_ptr<UnaryOpNode> unary = std::dynamic_pointer_cast<UnaryOpNode>(node);
+        return unary->op_tok.matches(TT_KEYWORD, "NOT") && is_numeric(unary->node);
+    }
+    if (class_name == "BinOpNode") {
+        std::shared_ptr<BinOpNode> bin_op = std::dynamic_pointer_cast<BinOpNode>(node);
+        std::string type_ = bin_op->op_tok.type_;
+        bool is_test = type_ == TT_EE || type_ == TT_NE || type_ == TT_LT || type_ == TT_GT || type_ == TT_LTE || type_ == TT_GTE
+            || bin_op->op_tok.matches(TT_KEYWORD, "AND") || bin_op->op_tok.matches(TT_KEYWORD, "OR");
+        return is_test && is_numeric(bin_op->left_node);
+    }
+    return false;
+}
+
+// The Number kernel visit_BinOpNode would apply. False if op is not a
+// Number operation or it fails.
+static bool apply_number_op(Opcode op, double left, double right, double& result) {
+    if (op == Opcode::count) return false;
+    return number_kernels[static_cast<size_t>(op)](left, right, result);
+}
+
+static std::shared_ptr<Node> fold_bin_op(std::shared_ptr<BinOpNode> bin_op) {
+    std::shared_ptr<Node> left = bin_op->left_node, right = bin_op->right_node;
+    Token op_tok = bin_op->op_tok;
+
+    if (left->get_class_name() == "NumberNode") {
+        double left_value = std::dynamic_pointer_cast<NumberNode>(left)->tok.value;
+        // The right operand of a decided AND or OR never runs, whatever it is
+        if (op_tok.matches(TT_KEYWORD, "AND") && left_value == 0) return number_node(0, bin_op->pos_start, bin_op->pos_end);
+        if (op_tok.matches(TT_KEYWORD, "OR") && left_value != 0) return number_node(1, bin_op->pos_start, bin_op->pos_end);
+
+        double result;
+        if (right->get_class_name() == "NumberNode" && apply_number_op(bin_op->opcode, left_value, std::dynamic_pointer_cast<NumberNode>(right)->tok.value, result)) {
+            return number_node(result, bin_op->pos_start, bin_op->pos_end);
+        }
+    }
+
+    if (left->get_class_name() == "StringNode") {
+        std::string left_text = std::dynamic_pointer_cast<StringNode>(left)->tok.text;
+        std::string folded;
+        if (op_tok.type_ == TT_PLUS && right->get_class_name() == "StringNode") {
+            folded = left_text + std::dynamic_pointer_cast<StringNode>(right)->tok.text;
+        }
+        else if (op_tok.type_ == TT_MUL && right->get_class_name() == "NumberNode") {
+            double count = std::ceil(std::max(0.0, std::dynamic_pointer_cast<NumberNode>(right)->tok.value));
+            if (left_text.size() * count > max_folded_string) return bin_op;
+            folded = String(left_text).multed_by(std::make_shared<Number>(Number(count))).first.value;
+        }
+        else return bin_op;
+
+        if (folded.size() > max_folded_string) return bin_op;
+        return std::make_shared<StringNode>(Token(TT_STRING, DBL_MAX, folded, bin_op->pos_start, bin_op->pos_end));
+    }
+
+    if (op_tok.type_ == TT_MUL && is_number_node(right, 1) && is_numeric(left)) return left;
+    if (op_tok.type_ == TT_MUL && is_number_node(left, 1) && is_numeric(right)) return right;
+    // Not x + 0 or 0 + x: -0 + 0 is 0, so they would keep a -0 that the
+    // addition turns into 0
+    if (op_tok.type_ == TT_MINUS && is_number_node(right, 0) && is_numeric(left)) return left;
+    return bin_op;
+}
+
+static std::shared_ptr<Node> fold(std::shared_ptr<Node> node, const std::map<std::string, double>& constants) {
+    if (node == nullptr) return node;
+    for (auto slot : child_slots(node)) *slot = fold(*slot, constants);
+    std::string class_name = node->get_class_name();
+
+    if (class_name == "VarAccessNode") {
+        std::shared_ptr<VarAccessNode> access = std::dynamic_pointer_cast<VarAccessNode>(node);
+        auto constant = constants.find(access->var_name_tok.text);
+        if (constant != constants.end()) return number_node(constant->second, access->pos_start, access->pos_end);
+    }
+    else if (class_name == "UnaryOpNode") {
+        std::shared_ptr<UnaryOpNode> unary = std::dynamic_pointer_cast<UnaryOpNode>(node);
+        bool is_not = unary->op_tok.matches(TT_KEYWORD, "NOT");
+        if (unary->node->get_class_name() == "NumberNode") {
+            double value = std::dynamic_pointer_cast<NumberNode>(unary->node)->tok.value;
+            if (unary->op_tok.type_ == TT_MINUS) return number_node(value * -1, unary->pos_start, unary->pos_end);
+            if (is_not) return number_node(value == 0 ? 1 : 0, unary->pos_start, unary->pos_end);
+        }
+        if (is_not && unary->node->get_class_name() == "UnaryOpNode") {
+            std::shared_ptr<UnaryOpNode> inner = std::dynamic_pointer_cast<UnaryOpNode>(unary->node);
+            if (inner->op_tok.matches(TT_KEYWORD, "NOT") && is_boolean(inner->node)) return inner->node;
+        }
+    }
+    else if (class_name == "BinOpNode") {
+        return fold_bin_op(std::dynamic_pointer_cast<BinOpNode>(node));
+    }
+    return node;
+}
+
+bool is_builtin_constant(const std::string& name) {
+    return name == "NULL" || name == "TRUE" || name == "FALSE" || name == "MATH_PI";
+}
+
+std::shared_ptr<Node> fold_constants(std::shared_ptr<Node> node, SymbolTable* globals) {
+    std::set<std::string> assigned;
+    collect_assigned(node, assigned);
+
+    std::map<std::string, double> constants;
+    const std::pair<std::string, double> builtins[] = {
+        { "NULL", Number::null_.value }, { "TRUE", Number::true_.value },
+        { "FALSE", Number::false_.value }, { "MATH_PI", Number::math_PI_.value }
+    };
+    for (auto& builtin : builtins) {
+        if (assigned.count(builtin.first) != 0) continue;
+        if (globals != nullptr) {
+            std::shared_ptr<Node> value = globals->get(builtin.first);
+            if (value == nullptr || value->get_class_name() != "Number") continue;
+            if (std::dynamic_pointer_cast<Number>(value)->value != builtin.second || std::dynamic_pointer_cast<Number>(value)->is_none) continue;
+        }
+        constants[builtin.first] = builtin.second;
+    }
+
+    return fold(node, constants);
+}
+
+////////////////////////////
+///// LOOP INVARIANTS //////
+////////////////////////////
+
+// Whether evaluating node can do nothing but compute a value: operators
+// over literals and variables, no calls and no assignments
+static bool is_pure(std::shared_ptr<Node> node) {
+    std::string class_name = node->get_class_name();
+    if (class_name == "NumberNode" || class_name == "StringNode" || class_name == "VarAccessNode") return true;
+    if (class_name == "UnaryOpNode") return is_pure(std::dynamic_pointer_cast<UnaryOpNode>(node)->node);
+    if (class_name == "BinOpNode") {
+        return is_pure(std::dynamic_pointer_cast<BinOpNode>(node)->left_node) && is_pure(std::dynamic_pointer_cast<BinOpNode>(node)->right_node);
+    }
+    return false;
+}
+
+static bool is_operator(std::shared_ptr<Node> node) {
+    return node->get_class_name() == "BinOpNode" || node->get_class_name() == "UnaryOpNode";
+}
+
+static void collect_reads(std::shared_ptr<Node> node, std::vector<std::string>& names) {
+    if (node->get_class_name() == "VarAccessNode") {
+        std::string name = std::dynamic_pointer_cast<VarAccessNode>(node)->var_name_tok.text;
+        if (std::find(names.begin(), names.end(), name) == names.end()) names.push_back(name);
+    }
+    for (auto slot : child_slots(node)) collect_reads(*slot, names);
+}
+
+// Equal for pure expressions that always compute the same value
+static std::string expression_key(std::shared_ptr<Node> node) {
+    std::ostringstream key;
+    key.precision(17);
+    std::string class_name = node->get_class_name();
+    if (class_name == "NumberNode") key << "n" << std::dynamic_pointer_cast<NumberNode>(node)->tok.value;
+    else if (class_name == "StringNode") key << "s" << std::dynamic_pointer_cast<StringNode>(node)->tok.text.size() << ":" << std::dynamic_pointer_cast<StringNode>(node)->tok.text;
+    else if (class_name == "VarAccessNode") key << "v" << std::dynamic_pointer_cast<VarAccessNode>(node)->var_name_tok.text << ";";
+    else if (class_name == "UnaryOpNode") {
+        std::shared_ptr<UnaryOpNode> unary = std::dynamic_pointer_cast<UnaryOpNode>(node);
+        key << "(" << unary->op_tok.type_ << ":" << unary->op_tok.text << " " << expression_key(unary->node) << ")";
+    }
+    else if (class_name == "BinOpNode") {
+        std::shared_ptr<BinOpNode> bin_op = std::dynamic_pointer_cast<BinOpNode>(node);
+        key << "(" << bin_op->op_tok.type_ << ":" << bin_op->op_tok.text << " " << expression_key(bin_op->left_node) << " " << expression_key(bin_op->right_node) << ")";
+    }
+    return key.str();
+}
+
+static std::shared_ptr<CachedNode> cached_node(std::shared_ptr<Node> node, std::string slot_name, CachedNode::Mode mode) {
+    Position pos_start, pos_end;
+    if (node->get_class_name() == "BinOpNode") {
+        pos_start = std::dynamic_pointer_cast<BinOpNode>(node)->pos_start;
+        pos_end = std::dynamic_pointer_cast<BinOpNode>(node)->pos_end;
+    }
+    else {
+        pos_start = std::dynamic_pointer_cast<UnaryOpNode>(node)->pos_start;
+        pos_end = std::dynamic_pointer_cast<UnaryOpNode>(node)->pos_end;
+    }
+    std::shared_ptr<CachedNode> cached = std::make_shared<CachedNode>(node, slot_name, mode, pos_start, pos_end);
+    collect_reads(node, cached->input_names);
+    return cached;
+}
+
+namespace {
+    // A loop the expression being looked at runs in
+    struct Loop
+    {
+        std::set<std::string> assigned;          // names the loop may rebind
+        std::map<std::string, std::string> slots; // expression_key -> slot name
+        std::vector<std::string>* cached_slots;
+    };
+}
+
+static void hoist(std::shared_ptr<Node>* slot, std::vector<Loop>& loops, size_t& next_slot) {
+    std::shared_ptr<Node> node = *slot;
+    if (node == nullptr) return;
+    std::string class_name = node->get_class_name();
+
+    if (!loops.empty() && is_operator(node) && is_pure(node)) {
+        std::vector<std::string> reads;
+        collect_reads(node, reads);
+        // Outermost first: a loop rebinds everything its inner loops do
+        for (Loop& loop : loops) {
+            bool is_invariant = true;
+            for (const std::string& name : reads) {
+                if (loop.assigned.count(name) != 0) is_invariant = false;
+            }
+            if (!is_invariant) continue;
+
+            std::string key = expression_key(node);
+            if (loop.slots.count(key) == 0) {
+                loop.slots[key] = "$invariant" + std::to_string(next_slot++);
+                loop.cached_slots->push_back(loop.slots[key]);
+            }
+            *slot = cached_node(node, loop.slots[key], CachedNode::Mode::Invariant);
+            return;
+        }
+    }
+
+    if (class_name == "FuncDefNode" || (class_name == "ForNode" && std::dynamic_pointer_cast<ForNode>(node)->is_parallel)) {
+        // Function bodies and PARFOR iterations run in contexts of their own
+        std::vector<Loop> own_loops;
+        if (class_name == "ForNode") {
+            std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+            hoist(&for_node->start_value_node, loops, next_slot);
+            hoist(&for_node->end_value_node, loops, next_slot);
+            hoist(&for_node->step_value_node, loops, next_slot);
+            hoist(&for_node->body_node, own_loops, next_slot);
+        }
+        else hoist(&std::dynamic_pointer_cast<FuncDefNode>(node)->body_node, own_loops, next_slot);
+        return;
+    }
+
+    if (class_name == "ForNode") {
+        std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+        // The bounds are evaluated once, before the loop starts
+        hoist(&for_node->start_value_node, loops, next_slot);
+        hoist(&for_node->end_value_node, loops, next_slot);
+        hoist(&for_node->step_value_node, loops, next_slot);
+
+        Loop loop;
+        loop.assigned.insert(for_node->var_name_tok.text);
+        collect_assigned(for_node->body_node, loop.assigned);
+        loop.cached_slots = &for_node->cached_slots;
+        loops.push_back(loop);
+        hoist(&for_node->body_node, loops, next_slot);
+        loops.pop_back();
+        return;
+    }
+
+    if (class_name == "WhileNode") {
+        std::shared_ptr<WhileNode> while_node = std::dynamic_pointer_cast<WhileNode>(node);
+        Loop loop;
+        collect_assigned(while_node->condition_node, loop.assigned);
+        collect_assigned(while_node->body_node, loop.assigned);
+        loop.cached_slots = &while_node->cached_slots;
+        loops.push_back(loop);
+        hoist(&while_node->condition_node, loops, next_slot);
+        hoist(&while_node->body_node, loops, next_slot);
+        loops.pop_back();
+        return;
+    }
+
+    for (auto child : child_slots(node)) hoist(child, loops, next_slot);
+}
+
+void hoist_invariants(std::shared_ptr<Node> node) {
+    std::vector<Loop> loops;
+    size_t next_slot = 0;
+    if (node != nullptr) hoist(&node, loops, next_slot);
+}
+
+////////////////////////////
+/// COMMON SUBEXPRESSIONS //
+////////////////////////////
+
+// Operators over literals and variables evaluated in full, left to right:
+// pure and without the AND and OR that may skip their right operand
+static bool is_straight_line(std::shared_ptr<Node> node) {
+    if (!is_pure(node)) return false;
+    if (node->get_class_name() == "BinOpNode") {
+        std::shared_ptr<BinOpNode> bin_op = std::dynamic_pointer_cast<BinOpNode>(node);
+        if (bin_op->op_tok.matches(TT_KEYWORD, "AND") || bin_op->op_tok.matches(TT_KEYWORD, "OR")) return false;
+        return is_straight_line(bin_op->left_node) && is_straight_line(bin_op->right_node);
+    }
+    if (node->get_class_name() == "UnaryOpNode") return is_straight_line(std::dynamic_pointer_cast<UnaryOpNode>(node)->node);
+    return true;
+}
+
+static void count_keys(std::shared_ptr<Node> node, std::map<std::string, size_t>& counts) {
+    if (!is_operator(node)) return;
+    counts[expression_key(node)]++;
+    for (auto slot : child_slots(node)) count_keys(*slot, counts);
+}
+
+// Outermost repeated subexpressions in evaluation order. Equal subtrees
+// never nest, so the first one found is also the first one evaluated.
+static void find_repeated(std::shared_ptr<Node>* slot, const std::map<std::string, size_t>& counts, std::vector<std::shared_ptr<Node>*>& repeated) {
+    if (!is_operator(*slot)) return;
+    if (counts.at(expression_key(*slot)) > 1) {
+        repeated.push_back(slot);
+        return;
+    }
+    for (auto child : child_slots(*slot)) find_repeated(child, counts, repeated);
+}
+
+static void eliminate(std::shared_ptr<Node>* slot, size_t& next_slot) {
+    std::shared_ptr<Node> node = *slot;
+    if (node == nullptr || node->get_class_name() == "CachedNode") return;
+
+    if (is_operator(node) && is_straight_line(node)) {
+        std::map<std::string, size_t> counts;
+        count_keys(node, counts);
+        std::vector<std::shared_ptr<Node>*> repeated;
+        for (auto child : child_slots(node)) find_repeated(child, counts, repeated);
+
+        std::map<std::string, std::vector<std::shared_ptr<Node>*>> groups;
+        for (auto occurrence : repeated) groups[expression_key(*occurrence)].push_back(occurrence);
+        for (auto& group : groups) {
+            if (group.second.size() < 2) continue;
+            std::string slot_name = "$common" + std::to_string(next_slot++);
+            for (size_t i = 0; i < group.second.size(); i++) {
+                CachedNode::Mode mode = i == 0 ? CachedNode::Mode::Define : CachedNode::Mode::Use;
+                *group.second[i] = cached_node(*group.second[i], slot_name, mode);
+            }
+        }
+        return;
+    }
+
+    for (auto child : child_slots(node)) eliminate(child, next_slot);
+}
+
+void eliminate_common_subexpressions(std::shared_ptr<Node> node) {
+    size_t next_slot = 0;
+    eliminate(&node, next_slot);
+}
+
+////////////////////////////
+/////// TYPE INFERENCE /////
+////////////////////////////
+
+namespace {
+    enum class StaticType { Unknown, Number, String, List };
+
+    // What each variable of one scope is proven to hold. Names missing are
+    // Unknown: with dynamic scoping they may come from any caller.
+    typedef std::map<std::string, StaticType> TypeEnv;
+
+    struct TypeState
+    {
+        bool annotate;                    // false while a loop's types are still settling
+        std::vector<std::string>* untyped; // report, if one was asked for
+    };
+}
+
+static StaticType join(StaticType a, StaticType b) {
+    return a == b ? a : StaticType::Unknown;
+}
+
+static TypeEnv join(const TypeEnv& a, const TypeEnv& b) {
+    TypeEnv joined;
+    for (auto& entry : a) {
+        auto other = b.find(entry.first);
+        if (other != b.end() && other->second == entry.second) joined.insert(entry);
+    }
+    return joined;
+}
+
+static void bind_type(TypeEnv& env, const std::string& name, StaticType type) {
+    if (type == StaticType::Unknown) env.erase(name);
+    else env[name] = type;
+}
+
+static std::string source_text(const Position& pos_start, const Position& pos_end) {
+    if (pos_start.idx < 0 || pos_end.idx < pos_start.idx || static_cast<size_t>(pos_end.idx) > pos_start.ftxt.size()) return "";
+    return std::string(pos_start.ftxt.substr(pos_start.idx, pos_end.idx - pos_start.idx));
+}
+
+static StaticType infer(std::shared_ptr<Node> node, TypeEnv& env, TypeState& state);
+
+// Runs a loop body until the types at the loop head stop changing, then once
+// more to annotate. Returns the types at the loop head.
+static TypeEnv infer_loop(TypeEnv entry, const std::function<void(TypeEnv&)>& iteration, TypeState& state) {
+    bool annotate = state.annotate;
+    state.annotate = false;
+    while (true) {
+        TypeEnv after = entry;
+        iteration(after);
+        TypeEnv next = join(entry, after);
+        if (next == entry) break;
+        entry = next;
+    }
+    state.annotate = annotate;
+    TypeEnv after = entry;
+    iteration(after);
+    return entry;
+}
+
+static StaticType infer_bin_op(std::shared_ptr<BinOpNode> bin_op, TypeEnv& env, TypeState& state) {
+    StaticType left = infer(bin_op->left_node, env, state), right;
+    if (bin_op->op_tok.matches(TT_KEYWORD, "AND") || bin_op->op_tok.matches(TT_KEYWORD, "OR")) {
+        // The right operand may not run at all
+        TypeEnv right_env = env;
+        right = infer(bin_op->right_node, right_env, state);
+        env = join(env, right_env);
+    }
+    else right = infer(bin_op->right_node, env, state);
+
+    if (state.annotate) {
+        bin_op->numeric_operands = left == StaticType::Number && right == StaticType::Number;
+        if (state.untyped != nullptr && (left == StaticType::Unknown || right == StaticType::Unknown)) {
+            std::ostringstream line;
+            line << bin_op->pos_start.fn << ":" << bin_op->pos_start.ln + 1 << ":" << bin_op->pos_start.col + 1 << ": '"
+                << source_text(bin_op->pos_start, bin_op->pos_end) << "': "
+                << (left == StaticType::Unknown ? "left" : "right") << " operand has no proven type";
+            state.untyped->push_back(line.str());
+        }
+    }
+
+    // The left operand picks the operation, see visit_BinOpNode
+    if (left == StaticType::Number || left == StaticType::String) return left;
+    if (left == StaticType::List && bin_op->op_tok.type_ != TT_DIV) return StaticType::List;
+    return StaticType::Unknown;
+}
+
+static StaticType infer(std::shared_ptr<Node> node, TypeEnv& env, TypeState& state) {
+    if (node == nullptr) return StaticType::Unknown;
+    std::string class_name = node->get_class_name();
+
+    if (class_name == "NumberNode") return StaticType::Number;
+    if (class_name == "StringNode") return StaticType::String;
+    if (class_name == "ListNode") {
+        for (auto& element : std::dynamic_pointer_cast<ListNode>(node)->element_nodes) infer(element, env, state);
+        return StaticType::List;
+    }
+    if (class_name == "VarAccessNode") {
+        auto found = env.find(std::dynamic_pointer_cast<VarAccessNode>(node)->var_name_tok.text);
+        return found != env.end() ? found->second : StaticType::Unknown;
+    }
+    if (class_name == "VarAssignNode") {
+        std::shared_ptr<VarAssignNode> assign = std::dynamic_pointer_cast<VarAssignNode>(node);
+        StaticType type = infer(assign->value_node, env, state);
+        bind_type(env, assign->var_name_tok.text, type);
+        return type;
+    }
+    if (class_name == "BinOpNode") return infer_bin_op(std::dynamic_pointer_cast<BinOpNode>(node), env, state);
+    if (class_name == "UnaryOpNode") {
+        StaticType operand = infer(std::dynamic_pointer_cast<UnaryOpNode>(node)->node, env, state);
+        return operand == StaticType::Number ? StaticType::Number : StaticType::Unknown;
+    }
+    if (class_name == "CachedNode") return infer(std::dynamic_pointer_cast<CachedNode>(node)->expr_node, env, state);
+    if (class_name == "IfNode") {
+        std::shared_ptr<IfNode> if_node = std::dynamic_pointer_cast<IfNode>(node);
+        // Each condition runs after the ones before it failed
+        TypeEnv conditions = env, out;
+        StaticType result = StaticType::Unknown;
+        bool first = true;
+        auto add_branch = [&](std::shared_ptr<Node> branch_node) {
+            TypeEnv branch = conditions;
+            StaticType type = branch_node != nullptr ? infer(branch_node, branch, state) : StaticType::Number;
+            out = first ? branch : join(out, branch);
+            result = first ? type : join(result, type);
+            first = false;
+        };
+        for (auto& case_ : if_node->cases) {
+            infer(case_[0], conditions, state);
+            add_branch(case_[1]);
+        }
+        add_branch(if_node->else_case); // null when there is no ELSE
+        env = out;
+        return result;
+    }
+    if (class_name == "ForNode") {
+        std::shared_ptr<ForNode> for_node = std::dynamic_pointer_cast<ForNode>(node);
+        std::string var_name = for_node->var_name_tok.text;
+        infer(for_node->start_value_node, env, state);
+        infer(for_node->end_value_node, env, state);
+        infer(for_node->step_value_node, env, state);
+
+        if (for_node->is_parallel) {
+            // Iterations get contexts of their own and cannot assign outer variables
+            TypeEnv iteration = env;
+            iteration[var_name] = StaticType::Number;
+            infer(for_node->body_node, iteration, state);
+        }
+        else {
+            env = infer_loop(env, [&](TypeEnv& iteration) {
+                iteration[var_name] = StaticType::Number;
+                infer(for_node->body_node, iteration, state);
+            }, state);
+        }
+        return for_node->is_void ? StaticType::Number : StaticType::List;
+    }
+    if (class_name == "WhileNode") {
+        std::shared_ptr<WhileNode> while_node = std::dynamic_pointer_cast<WhileNode>(node);
+        env = infer_loop(env, [&](TypeEnv& iteration) {
+            infer(while_node->condition_node, iteration, state);
+            infer(while_node->body_node, iteration, state);
+        }, state);
+        // The loop ends after its condition ran once more
+        bool annotate = state.annotate;
+        state.annotate = false;
+        infer(while_node->condition_node, env, state);
+        state.annotate = annotate;
+        return while_node->is_void ? StaticType::Number : StaticType::List;
+    }
+    if (class_name == "FuncDefNode") {
+        std::shared_ptr<FuncDefNode> func_def = std::dynamic_pointer_cast<FuncDefNode>(node);
+        TypeEnv body_env;
+        infer(func_def->body_node, body_env, state);
+        if (!func_def->var_name_tok.text.empty()) env.erase(func_def->var_name_tok.text);
+        return StaticType::Unknown;
+    }
+    if (class_name == "CallNode") {
+        std::shared_ptr<CallNode> call = std::dynamic_pointer_cast<CallNode>(node);
+        infer(call->node_to_call, env, state);
+        for (auto& arg : call->arg_nodes) infer(arg, env, state);
+        return StaticType::Unknown;
+    }
+    return StaticType::Unknown;
+}
+
+void infer_types(std::shared_ptr<Node> node, std::vector<std::string>* untyped) {
+    TypeEnv env;
+    TypeState state = { true, untyped };
+    infer(node, env, state);
+}
+
+////////////////////////////
+//////// TAIL CALLS ////////
+////////////////////////////
+
+// VAR, FOR and FUN: whatever binds a name in the frame it runs in
+static bool binds_names(std::shared_ptr<Node> node) {
+    if (node == nullptr) return false;
+    std::string class_name = node->get_class_name();
+    if (class_name == "VarAssignNode" || class_name == "ForNode" || class_name == "FuncDefNode") return true;
+    for (std::shared_ptr<Node>* slot : child_slots(node)) {
+        if (binds_names(*slot)) return true;
+    }
+    return false;
+}
+
+// A block's value is the list of all its statements, so only IF passes its
+// tail position on
+static void mark_tail_position(std::shared_ptr<Node> node) {
+    if (node == nullptr) return;
+    std::string class_name = node->get_class_name();
+
+    if (class_name == "CallNode") {
+        std::dynamic_pointer_cast<CallNode>(node)->is_tail_call = true;
+    }
+    else if (class_name == "IfNode") {
+        std::shared_ptr<IfNode> if_node = std::dynamic_pointer_cast<IfNode>(node);
+        for (auto& case_ : if_node->cases) mark_tail_position(case_[1]);
+        mark_tail_position(if_node->else_case);
+    }
+}
+
+void mark_tail_calls(std::shared_ptr<Node> node) {
+    if (node == nullptr) return;
+    if (node->get_class_name() == "FuncDefNode") {
+        std::shared_ptr<Node> body = std::dynamic_pointer_cast<FuncDefNode>(node)->body_node;
+        if (!binds_names(body)) mark_tail_position(body);
+    }
+    for (std::shared_ptr<Node>* slot : child_slots(node)) mark_tail_calls(*slot);
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class Node;
+class SymbolTable;
+
+// Passes over a parsed program, run by parse_program between
+// Parser::parse() and execution. Each one rewrites or annotates the AST in
+// place and must leave the program's observable behaviour unchanged.
+
+// Marks FOR and WHILE loops whose value nobody reads so that the
+// interpreter skips building their result lists. In a block every statement
+// but the last is unused; the body of an unused loop is unused too, and so
+// are the branches of an unused IF.
+void mark_void_context(std::shared_ptr<Node> node, bool is_void = false);
+
+// NULL, TRUE, FALSE and MATH_PI: names add_builtins defines as numbers
+bool is_builtin_constant(const std::string& name);
+
+// Evaluates operators whose operands are all NumberNodes or StringNodes at
+// parse time, with the same Number and String operations the interpreter
+// uses, and replaces them by the result. Operations that would fail, such as
+// a division by zero, are left for the interpreter to report. Also
+//   x * 1, 1 * x, x - 0                ->  x   when x is always a Number
+//   NOT NOT x                          ->  x   when x is always 0 or 1
+//   0 AND x, 1 OR x                    ->  0, 1 (x is never evaluated)
+// Builtin constants are folded unless the program assigns to them or, when
+// globals are given, they no longer hold their builtin value there.
+// Returns the node to use in place of node.
+std::shared_ptr<Node> fold_constants(std::shared_ptr<Node> node, SymbolTable* globals = nullptr);
+
+// Wraps the side-effect free expressions in FOR and WHILE loops whose
+// variables the loop never rebinds in Invariant CachedNodes, so they are
+// computed on the first iteration that reaches them and reused after that.
+// A loop's cache is tied to the loop it is invariant in, the outermost one
+// possible, which clears it on entry. Only VAR, FOR and FUN rebind names in
+// a context; functions called from the loop assign in frames of their own.
+// Function bodies and PARFOR bodies are not hoisted out of.
+void hoist_invariants(std::shared_ptr<Node> node);
+
+// Within one expression of operators over literals and variables, computes
+// each repeated subexpression once (CachedNode Define) and reuses its value
+// for the later copies (CachedNode Use).
+void eliminate_common_subexpressions(std::shared_ptr<Node> node);
+
+// Flow-sensitive inference of Number, String and List types for variables
+// and expressions. BinOpNodes whose operands are both proven Numbers get
+// numeric_operands set, and visit_BinOpNode runs them without type checks.
+// Loops are iterated until the types at their head settle, IF branches and
+// the right operand of AND and OR are joined, and function bodies start
+// with nothing known, since callers' variables reach them dynamically.
+// Functions cannot assign their callers' variables, so calls change nothing.
+// If untyped is given, a line is added for every operator whose operands
+// could not both be typed (basic --types).
+void infer_types(std::shared_ptr<Node> node, std::vector<std::string>* untyped = nullptr);
+
+// Marks calls in tail position of function bodies, the body itself and the
+// branches of an IF in tail position, so that Function::execute_result makes
+// them one after the other instead of nesting them. Only bodies that bind no
+// names but their parameters are marked: the frame of such a call holds
+// nothing the callee could still look up, so a call to the same function can
+// take it over, and no closure can have been made in it.
+void mark_tail_calls(std::shared_ptr<Node> node);
@@ -0,0 +1,243 @@
+#include "profiler.h"
+#include "basic.h"
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <sstream>
+
+#ifndef _WIN32
+#include <csignal>
+#include <sys/time.h>
+#endif
+
+std::atomic<bool> Profiler::active(false);
+std::vector<Profiler::Stack> Profiler::stacks;
+size_t Profiler::dropped = 0;
+int Profiler::frequency_hz = 0;
+
+namespace {
+    const size_t max_frames = 32;        // deeper stacks keep their innermost frames
+    const size_t sample_capacity = 1 << 15;
+
+    // What a thread is evaluating right now, read by the signal handler on
+    // that same thread
+    struct ProfiledPoint
+    {
+        Context* volatile context;
+        const Position* volatile position;
+    };
+    thread_local ProfiledPoint current = { nullptr, nullptr };
+
+    struct RawSample
+    {
+        std::atomic<bool> ready;
+        size_t depth;
+        const Context* contexts[max_frames];
+        const Position* positions[max_frames];
+    };
+
+    std::unique_ptr<RawSample[]> samples;
+    std::atomic<size_t> next_sample(0);
+
+    const Position* position_of(const Node* node) {
+        if (auto n = dynamic_cast<const NumberNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const StringNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const ListNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const VarAccessNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const VarAssignNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const BinOpNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const UnaryOpNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const IfNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const ForNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const WhileNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const FuncDefNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const CallNode*>(node)) return &n->pos_start;
+        if (auto n = dynamic_cast<const CachedNode*>(node)) return &n->pos_start;
+        return nullptr;
+    }
+
+#ifndef _WIN32
+    // Async-signal-safe: only reads the interrupted thread's frames and writes
+    // into a slot of the preallocated buffer
+    void take_sample(int) {
+        if (!Profiler::is_active()) return;
+        const Context* context = current.context;
+        const Position* position = current.position;
+        if (context == nullptr) return;
+
+        size_t slot = next_sample.fetch_add(1, std::memory_order_relaxed);
+        if (slot >= sample_capacity) return;
+
+        RawSample& sample = samples[slot];
+        size_t depth = 0;
+        while (context != nullptr && depth < max_frames) {
+            sample.contexts[depth] = context;
+            sample.positions[depth] = position;
+            depth++;
+            position = &context->parent_entry_pos;
+            context = context->parent;
+        }
+        sample.depth = depth;
+        sample.ready.store(true, std::memory_order_release);
+    }
+#endif
+
+    std::string percent(size_t count, size_t total) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(1) << (total == 0 ? 0.0 : 100.0 * count / total) << "%";
+        return out.str();
+    }
+
+    struct Tally
+    {
+        size_t self = 0, total = 0;
+    };
+
+    void write_table(std::ostringstream& out, const std::string& title, const std::map<std::string, Tally>& tallies, size_t sample_count) {
+        std::vector<std::pair<std::string, Tally>> rows(tallies.begin(), tallies.end());
+        std::sort(rows.begin(), rows.end(), [](const std::pair<std::string, Tally>& a, const std::pair<std::string, Tally>& b) {
+            if (a.second.self != b.second.self) return a.second.self > b.second.self;
+            return a.second.total > b.second.total;
+        });
+
+        out << "\n" << std::left << std::setw(48) << title << std::right << std::setw(9) << "self" << std::setw(9) << "total" << "\n";
+        for (auto& row : rows) {
+            out << "  " << std::left << std::setw(46) << row.first << std::right
+                << std::setw(9) << percent(row.second.self, sample_count)
+                << std::setw(9) << percent(row.second.total, sample_count) << "\n";
+        }
+    }
+}
+
+void ProfileScope::enter(const std::shared_ptr<Node>& node, Context* context) {
+    entered = true;
+    saved_context = current.context;
+    saved_position = current.position;
+    const Position* position = position_of(node.get());
+    // The handler must never see a frame without a position, so the
+    // position goes first
+    current.position = position != nullptr ? position : saved_position;
+    current.context = context;
+}
+
+void ProfileScope::leave() {
+    current.context = saved_context;
+    current.position = saved_position;
+}
+
+#ifdef _WIN32
+
+bool Profiler::start(int frequency_hz, std::string& error) {
+    error = "--profile needs SIGPROF timers, which this build does not support";
+    return false;
+}
+
+void Profiler::stop() {}
+
+#else
+
+bool Profiler::start(int frequency_hz, std::string& error) {
+    if (frequency_hz <= 0 || frequency_hz > 1000000) {
+        error = "profiling frequency must be between 1 and 1000000 Hz";
+        return false;
+    }
+    Profiler::frequency_hz = frequency_hz;
+    samples.reset(new RawSample[sample_capacity]);
+    for (size_t i = 0; i < sample_capacity; i++) samples[i].ready = false;
+    next_sample = 0;
+    stacks.clear();
+    dropped = 0;
+
+    struct sigaction action = {};
+    action.sa_handler = take_sample;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, nullptr) < 0) {
+        error = "cannot install the SIGPROF handler";
+        return false;
+    }
+
+    active = true;
+    itimerval timer = {};
+    timer.it_interval.tv_usec = 1000000 / frequency_hz;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) < 0) {
+        active = false;
+        error = "cannot start the profiling timer";
+        return false;
+    }
+    return true;
+}
+
+void Profiler::stop() {
+    if (!active) return;
+    active = false;
+
+    itimerval timer = {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    // A signal still in flight must not fall back to the default action,
+    // which would kill the process
+    signal(SIGPROF, SIG_IGN);
+
+    size_t taken = std::min(next_sample.load(), sample_capacity);
+    dropped = next_sample.load() - taken;
+    for (size_t i = 0; i < taken; i++) {
+        RawSample& sample = samples[i];
+        if (!sample.ready.load(std::memory_order_acquire)) continue;
+
+        Stack stack;
+        for (size_t k = 0; k < sample.depth; k++) {
+            Frame frame;
+            frame.function = sample.contexts[k]->display_name;
+            frame.file = sample.positions[k] != nullptr ? sample.positions[k]->fn : "";
+            frame.line = sample.positions[k] != nullptr ? sample.positions[k]->ln + 1 : 0;
+            stack.push_back(frame);
+        }
+        stacks.push_back(stack);
+    }
+}
+
+#endif
+
+// Self time goes to the innermost frame of each sample, total time to every
+// function and line on its stack, counted once however often it recurses
+std::string Profiler::report() {
+    std::map<std::string, Tally> functions, lines;
+    for (const Stack& stack : stacks) {
+        std::set<std::string> seen_functions, seen_lines;
+        for (size_t k = 0; k < stack.size(); k++) {
+            std::string line = stack[k].file + ":" + (stack[k].line > 0 ? std::to_string(stack[k].line) : "?") + " (" + stack[k].function + ")";
+            if (k == 0) {
+                functions[stack[k].function].self++;
+                lines[line].self++;
+            }
+            if (seen_functions.insert(stack[k].function).second) functions[stack[k].function].total++;
+            if (seen_lines.insert(line).second) lines[line].total++;
+        }
+    }
+
+    std::ostringstream out;
+    out << "Profile: " << stacks.size() << " samples at " << frequency_hz << " Hz";
+    if (dropped > 0) out << " (" << dropped << " dropped, buffer full)";
+    out << "\n";
+    write_table(out, "Function", functions, stacks.size());
+    write_table(out, "Line", lines, stacks.size());
+    return out.str();
+}
+
+std::string Profiler::folded() {
+    std::map<std::string, size_t> counts;
+    for (const Stack& stack : stacks) {
+        std::string line;
+        for (size_t k = stack.size(); k-- > 0;) {
+            line += stack[k].function;
+            if (k > 0) line += ";";
+        }
+        counts[line]++;
+    }
+
+    std::ostringstream out;
+    for (auto& count : counts) out << count.first << " " << count.second << "\n";
+    return out.str();
+}
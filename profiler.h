@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Node;
+class Context;
+class Position;
+
+// Sampling profiler for BASIC programs (basic --profile). A SIGPROF timer
+// interrupts whichever thread is using the CPU and records the BASIC call
+// stack it is running, walked up the Context chain, with the source line of
+// every frame. Samples are resolved into names when sampling stops and
+// reported as flat (self) and cumulative (total) time per function and line.
+class Profiler
+{
+public:
+    // One resolved sample, innermost frame first
+    struct Frame
+    {
+        std::string function; // Context::display_name
+        std::string file;
+        int line;
+    };
+    typedef std::vector<Frame> Stack;
+
+    // Returns false and sets error if sampling is not available
+    static bool start(int frequency_hz, std::string& error);
+    // The frames and AST of the sampled programs must still be alive
+    static void stop();
+    static std::string report();
+    // One line per distinct stack, outermost frame first, as read by
+    // flamegraph.pl and speedscope: "<program>;outer;inner <samples>"
+    static std::string folded();
+
+    static bool is_active() { return active.load(std::memory_order_relaxed); }
+
+    static std::atomic<bool> active;
+    static std::vector<Stack> stacks; // filled in by stop()
+    static size_t dropped;            // samples lost to a full buffer
+    static int frequency_hz;
+};
+
+// Tells the profiler which node a thread is evaluating and in which frame,
+// for as long as the scope lives. Does nothing unless the profiler runs.
+class ProfileScope
+{
+public:
+    ProfileScope(const std::shared_ptr<Node>& node, Context* context) {
+        if (Profiler::is_active()) enter(node, context);
+    }
+    ~ProfileScope() {
+        if (entered) leave();
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    void enter(const std::shared_ptr<Node>& node, Context* context);
+    void leave();
+
+    bool entered = false;
+    Context* saved_context = nullptr;
+    const Position* saved_position = nullptr;
+};
@@ -0,0 +1,339 @@
+#include "server.h"
+#include "basic.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <climits>
+#include <cstring>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+int serve(const std::string& socket_path, size_t worker_count, ExecutionLimits limits) {
+    std::cerr << "basic: --serve needs Unix domain sockets, which this build does not support" << std::endl;
+    return 2;
+}
+
+#else
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const size_t max_source_size = 64 * 1024 * 1024;
+    const size_t latency_window = 1024;
+    const std::chrono::seconds request_timeout(30);
+
+    struct Job
+    {
+        int fd;
+        Clock::time_point accepted;
+    };
+
+    class JobQueue
+    {
+    public:
+        void push(Job job) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                jobs.push_back(job);
+            }
+            available.notify_one();
+        }
+
+        Job pop() {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this] { return !jobs.empty(); });
+            Job job = jobs.front();
+            jobs.pop_front();
+            return job;
+        }
+
+        size_t depth() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return jobs.size();
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable available;
+        std::deque<Job> jobs;
+    };
+
+    // Counters for STATS. Latency runs from accept to the end of the reply
+    // and is kept for the most recent latency_window jobs.
+    class Metrics
+    {
+    public:
+        void job_started() {
+            std::lock_guard<std::mutex> lock(mutex);
+            running++;
+        }
+
+        void job_finished(double latency_ms, bool failed) {
+            std::lock_guard<std::mutex> lock(mutex);
+            running--;
+            completed++;
+            if (failed) this->failed++;
+            if (latencies.size() < latency_window) latencies.push_back(latency_ms);
+            else latencies[completed % latency_window] = latency_ms;
+        }
+
+        std::string report(size_t queue_depth, size_t workers) {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::vector<double> sorted = latencies;
+            std::sort(sorted.begin(), sorted.end());
+
+            std::ostringstream out;
+            out << "workers=" << workers << "\n";
+            out << "queue_depth=" << queue_depth << "\n";
+            out << "running=" << running << "\n";
+            out << "completed=" << completed << "\n";
+            out << "failed=" << failed << "\n";
+            out << "latency_p50_ms=" << percentile(sorted, 0.50) << "\n";
+            out << "latency_p90_ms=" << percentile(sorted, 0.90) << "\n";
+            out << "latency_p99_ms=" << percentile(sorted, 0.99) << "\n";
+            out << "latency_max_ms=" << (sorted.empty() ? 0 : sorted.back()) << "\n";
+            return out.str();
+        }
+
+    private:
+        static double percentile(const std::vector<double>& sorted, double fraction) {
+            if (sorted.empty()) return 0;
+            size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+            return sorted[index];
+        }
+
+        std::mutex mutex;
+        size_t running = 0, completed = 0, failed = 0;
+        std::vector<double> latencies;
+    };
+
+    bool write_all(int fd, const char* data, size_t size) {
+        while (size > 0) {
+            ssize_t written = ::write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            data += written;
+            size -= written;
+        }
+        return true;
+    }
+
+    // Waits until fd has data or the deadline passes, so a client that
+    // stalls mid-request cannot hold a worker forever
+    bool wait_readable(int fd, Clock::time_point deadline) {
+        while (true) {
+            long long left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+            if (left <= 0) return false;
+
+            pollfd poll_fd = { fd, POLLIN, 0 };
+            int ready = poll(&poll_fd, 1, static_cast<int>(std::min<long long>(left, INT_MAX)));
+            if (ready < 0 && errno == EINTR) continue;
+            return ready > 0;
+        }
+    }
+
+    bool read_exact(int fd, char* data, size_t size, Clock::time_point deadline) {
+        while (size > 0) {
+            if (!wait_readable(fd, deadline)) return false;
+            ssize_t got = ::read(fd, data, size);
+            if (got < 0 && errno == EINTR) continue;
+            if (got <= 0) return false;
+            data += got;
+            size -= got;
+        }
+        return true;
+    }
+
+    bool read_line(int fd, std::string& line, Clock::time_point deadline) {
+        line.clear();
+        char c;
+        while (line.size() < 4096) {
+            if (!read_exact(fd, &c, 1, deadline)) return false;
+            if (c == '\n') return true;
+            line += c;
+        }
+        return false;
+    }
+
+    void send_frame(int fd, char kind, std::string_view data) {
+        std::string header = std::string(1, kind) + " " + std::to_string(data.size()) + "\n";
+        if (write_all(fd, header.data(), header.size())) write_all(fd, data.data(), data.size());
+    }
+
+    double to_ms(Clock::duration duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    double to_ms(const timeval& time) {
+        return time.tv_sec * 1000.0 + time.tv_usec / 1000.0;
+    }
+
+    // CPU time of the calling thread only, tasks a job hands to the shared
+    // pool (PARFOR, SPAWN, ...) are not included
+    rusage thread_usage() {
+        rusage usage = {};
+#ifdef RUSAGE_THREAD
+        getrusage(RUSAGE_THREAD, &usage);
+#else
+        getrusage(RUSAGE_SELF, &usage);
+#endif
+        return usage;
+    }
+
+    // Returns false if the job failed
+    bool run_job(InterpreterInstance& instance, int fd, Clock::time_point accepted, Clock::time_point deadline, const std::string& name, size_t length) {
+        std::string source(length, '\0');
+        if (!read_exact(fd, &source[0], length, deadline)) return false;
+
+        size_t output_bytes = 0;
+        instance.output.set_writer([fd, &output_bytes](std::string_view data) {
+            output_bytes += data.size();
+            send_frame(fd, 'O', data);
+        });
+
+        Clock::time_point started = Clock::now();
+        rusage usage_before = thread_usage();
+
+        // The error points into the source and the instance's frames, so it
+        // is formatted before either goes away
+        std::pair<std::shared_ptr<Node>, Error> result = instance.run(name, source);
+        bool failed = result.second.is_error() != "None";
+        instance.output.set_writer(nullptr);
+        if (failed) send_frame(fd, 'E', result.second.as_string());
+
+        rusage usage_after = thread_usage();
+        Clock::time_point finished = Clock::now();
+        instance.reset();
+
+        std::ostringstream summary;
+        summary << "status=" << (failed ? "error" : "ok") << "\n";
+        summary << "queue_ms=" << to_ms(started - accepted) << "\n";
+        summary << "run_ms=" << to_ms(finished - started) << "\n";
+        summary << "cpu_user_ms=" << to_ms(usage_after.ru_utime) - to_ms(usage_before.ru_utime) << "\n";
+        summary << "cpu_sys_ms=" << to_ms(usage_after.ru_stime) - to_ms(usage_before.ru_stime) << "\n";
+        summary << "output_bytes=" << output_bytes << "\n";
+        send_frame(fd, 'S', summary.str());
+        return !failed;
+    }
+
+    // Every worker owns one instance for its whole life and resets it after
+    // each job instead of building a fresh interpreter
+    void worker_loop(JobQueue& queue, Metrics& metrics, size_t worker_count, ExecutionLimits limits) {
+        InterpreterInstance instance;
+        instance.limits = limits;
+
+        while (true) {
+            Job job = queue.pop();
+            metrics.job_started();
+            bool ok = true;
+
+            // The whole request has to arrive within request_timeout of the
+            // worker picking it up
+            Clock::time_point deadline = Clock::now() + request_timeout;
+            std::string line;
+            if (!read_line(job.fd, line, deadline)) {
+                ok = false;
+            }
+            else if (line == "STATS") {
+                send_frame(job.fd, 'S', metrics.report(queue.depth(), worker_count));
+            }
+            else {
+                std::istringstream request(line);
+                std::string command, name;
+                size_t length = 0;
+                request >> command >> name >> length;
+
+                if (command != "RUN" || name.empty() || request.fail() || length > max_source_size) {
+                    send_frame(job.fd, 'E', "Bad request, expected 'RUN <name> <length>' or 'STATS'");
+                    send_frame(job.fd, 'S', "status=bad_request\n");
+                    ok = false;
+                }
+                else ok = run_job(instance, job.fd, job.accepted, deadline, name, length);
+            }
+
+            close(job.fd);
+            metrics.job_finished(to_ms(Clock::now() - job.accepted), !ok);
+        }
+    }
+}
+
+int serve(const std::string& socket_path, size_t worker_count, ExecutionLimits limits) {
+    if (worker_count == 0) worker_count = std::max(1u, std::thread::hardware_concurrency());
+
+    // A client that hangs up early must not take the server down with it
+    signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        std::cerr << "basic: socket path too long: " << socket_path << std::endl;
+        return 2;
+    }
+    std::copy(socket_path.begin(), socket_path.end(), address.sun_path);
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        std::cerr << "basic: cannot create socket: " << std::strerror(errno) << std::endl;
+        return 2;
+    }
+
+    // Replace the socket a previous server left behind, but never anything else
+    struct stat existing;
+    if (lstat(socket_path.c_str(), &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            std::cerr << "basic: " << socket_path << " exists and is not a socket" << std::endl;
+            close(listener);
+            return 2;
+        }
+        unlink(socket_path.c_str());
+    }
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(listener, 128) < 0) {
+        std::cerr << "basic: cannot listen on " << socket_path << ": " << std::strerror(errno) << std::endl;
+        close(listener);
+        return 2;
+    }
+
+    JobQueue queue;
+    Metrics metrics;
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < worker_count; i++) {
+        workers.emplace_back(worker_loop, std::ref(queue), std::ref(metrics), worker_count, limits);
+    }
+
+    std::cerr << "basic: serving on " << socket_path << " with " << worker_count << " workers" << std::endl;
+    while (true) {
+        int client = accept(listener, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            std::cerr << "basic: accept failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+        queue.push(Job{ client, Clock::now() });
+    }
+
+    // Workers never return, leave them to the process exit
+    for (std::thread& worker : workers) worker.detach();
+    close(listener);
+    return 1;
+}
+
+#endif
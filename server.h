@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include "basic.h"
+
+// basic --serve: runs scripts submitted over a Unix domain socket on a pool of
+// interpreter instances that are reset and reused from job to job.
+//
+// One request per connection, either
+//   RUN <name> <length>\n followed by <length> bytes of source
+//   STATS\n
+// The reply is a sequence of frames, each "<kind> <length>\n<length bytes>":
+//   O  program output, streamed whenever the program's output is flushed
+//   E  the error that ended the program, formatted by Error::as_string()
+//   S  closing summary as key=value lines (the job's resource use for RUN,
+//      queue depth, latency percentiles and job counts for STATS)
+// Every job runs under the given limits, a job that exceeds one ends with an
+// E frame and the worker moves on to the next job. A request that has not
+// fully arrived 30 seconds after a worker picks it up is dropped unanswered.
+// An existing socket at socket_path is replaced; any other file there makes
+// serve() refuse to start.
+int serve(const std::string& socket_path, size_t worker_count = 0, ExecutionLimits limits = ExecutionLimits());
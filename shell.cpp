@@ -1,36 +1,233 @@
+#include <charconv>
+#include <cmath>
+#include <fstream>
 #include <iostream>
+#include <list>
 #include <string>
 #include "basic.h"
+#include "passes.h"
+#include "profiler.h"
+#include "server.h"
+#include "stats.h"
+#include "tracer.h"
+#include "source_file.h"
 
-int main() {
-	std::string inp, final_inp="";
+// Runs a whole script straight from its memory-mapped file.
+// Exit status: 0 on success, 1 if the program failed, 2 if the file could not be read.
+int run_file(const std::string& path) {
+	SourceFile source(path);
+	if (!source.is_open()) {
+		std::cerr << "basic: " << source.error << std::endl;
+		return 2;
+	}
+	// The parser wants at least one statement; like a blank line in the REPL,
+	// a blank script is an empty program that runs without output
+	if (source.text().find_first_not_of(" \t\r\n") == std::string_view::npos) return 0;
+
+	std::pair<std::shared_ptr<Node>, Error> finalResult = run(path, source.text());
+	Error error = finalResult.second;
+	// Samples point into the program's nodes, which go away with finalResult
+	Profiler::stop();
+
+	// The error positions point into the mapping, so report while it is still alive
+	if (error.is_error() != "None") {
+		std::cerr << error.as_string() << std::endl;
+		return 1;
+	}
+	return 0;
+}
+
+// basic --types: lists the operators whose operand types could not be
+// proven, which therefore keep their run-time type checks
+int check_types(const std::string& path) {
+	SourceFile source(path);
+	if (!source.is_open()) {
+		std::cerr << "basic: " << source.error << std::endl;
+		return 2;
+	}
+
+	std::pair<std::shared_ptr<Node>, Error> parsed = parse_program(path, source.text());
+	if (parsed.second.is_error() != "None") {
+		std::cerr << parsed.second.as_string() << std::endl;
+		return 1;
+	}
+	std::vector<std::string> untyped;
+	infer_types(parsed.first, &untyped);
+	for (const std::string& line : untyped) std::cerr << line << std::endl;
+	return 0;
+}
+
+int run_repl() {
+	// Functions defined on earlier lines keep pointing into the text they were
+	// parsed from, so every line entered stays alive for the whole session
+	std::list<std::string> history;
+	std::string inp;
 	while (true) {
 		std::cout << "basic > ";
-		std::getline(std::cin, inp);
+		if (!std::getline(std::cin, inp)) break;
 
-		final_inp = "";
-		for (auto x : inp) {
-			if (x != ' ' && x != '\t') final_inp += x;
-		}
+		if (inp.find_first_not_of(" \t\r") == std::string::npos) continue;
+		history.push_back(inp);
 
-		if (final_inp.empty()) continue;
-		
-		std::pair<std::shared_ptr<Node>, Error> finalResult = run("<stdin>", final_inp);
+		std::pair<std::shared_ptr<Node>, Error> finalResult = run("<stdin>", history.back());
 
 		std::shared_ptr<Node> ast = finalResult.first;
 		Error error = finalResult.second;
 
-		if (error.is_error() != "None" && error.is_error() != "Runtime Error: Division by zero") {
+		if (error.is_error() != "None") {
 			std::cout<<"Entered error block\n";
 			std::cout << error.as_string() << std::endl;
 		}
-		else if (error.is_error() == "Runtime Error: Division by zero") {
-			continue;
-		}
 		else {
 			//std::cout << *ast << std::endl;
 		}
 		std::cout << std::endl;
 	}
 	return 0;
-}
\ No newline at end of file
+}
+
+void print_usage() {
+	std::cerr << "usage: basic [--unbuffered] [--output-buffer=BYTES] [--stats[=FILE]] [--summary] [--stackless] [LIMITS] [script.bas]" << std::endl;
+	std::cerr << "       basic --types script.bas" << std::endl;
+	std::cerr << "       basic [--profile[=REPORT]] [--profile-folded=FILE] [--profile-hz=N] [--trace=FILE] [LIMITS] script.bas" << std::endl;
+	std::cerr << "       basic --serve SOCKET [--serve-workers=N] [LIMITS]" << std::endl;
+	std::cerr << "limits: --max-ops=N --max-depth=N --max-stack=N --max-time=SECONDS --max-memory=BYTES" << std::endl;
+}
+
+// The value of a numeric option such as --max-depth=N. False unless the
+// whole text after the '=' is a number of the option's type.
+template <typename T>
+bool option_value(const std::string& arg, size_t prefix_length, T& value) {
+	const char* begin = arg.data() + prefix_length;
+	const char* end = arg.data() + arg.size();
+	std::from_chars_result parsed = std::from_chars(begin, end, value);
+	return begin != end && parsed.ec == std::errc() && parsed.ptr == end;
+}
+
+int main(int argc, char** argv) {
+	std::string script, socket_path;
+	size_t serve_workers = 0;
+	ExecutionLimits limits;
+	bool profile = false, profile_report = false;
+	std::string profile_path, folded_path, trace_path, stats_path;
+	bool stats = false, summary = false, types = false, stackless = false;
+	int profile_hz = 1000;
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		bool valid = true;
+		if (arg == "--unbuffered") {
+			default_interpreter().output.set_unbuffered(true);
+		}
+		else if (arg.rfind("--output-buffer=", 0) == 0) {
+			size_t capacity;
+			if (!option_value(arg, 16, capacity)) valid = false;
+			else default_interpreter().output.set_capacity(capacity);
+		}
+		else if (arg == "--serve" && i + 1 < argc) {
+			socket_path = argv[++i];
+		}
+		else if (arg.rfind("--serve-workers=", 0) == 0) {
+			valid = option_value(arg, 16, serve_workers);
+		}
+		else if (arg == "--profile") {
+			profile = profile_report = true;
+		}
+		else if (arg.rfind("--profile=", 0) == 0) {
+			profile = profile_report = true;
+			profile_path = arg.substr(10);
+		}
+		else if (arg.rfind("--profile-folded=", 0) == 0) {
+			profile = true;
+			folded_path = arg.substr(17);
+		}
+		else if (arg.rfind("--trace=", 0) == 0) {
+			trace_path = arg.substr(8);
+		}
+		else if (arg.rfind("--profile-hz=", 0) == 0) {
+			valid = option_value(arg, 13, profile_hz);
+		}
+		else if (arg == "--summary") {
+			summary = true;
+		}
+		else if (arg == "--types") {
+			types = true;
+		}
+		else if (arg == "--stats") {
+			stats = true;
+		}
+		else if (arg.rfind("--stats=", 0) == 0) {
+			stats = true;
+			stats_path = arg.substr(8);
+		}
+		else if (arg.rfind("--max-ops=", 0) == 0) {
+			valid = option_value(arg, 10, limits.max_operations);
+		}
+		else if (arg.rfind("--max-depth=", 0) == 0) {
+			valid = option_value(arg, 12, limits.max_call_depth);
+		}
+		else if (arg.rfind("--max-stack=", 0) == 0) {
+			valid = option_value(arg, 12, limits.max_stack_depth);
+		}
+		else if (arg == "--stackless") {
+			stackless = true;
+		}
+		else if (arg.rfind("--max-time=", 0) == 0) {
+			// The deadline is now plus this, which has to be representable
+			valid = option_value(arg, 11, limits.max_seconds) && std::isfinite(limits.max_seconds) && limits.max_seconds >= 0;
+		}
+		else if (arg.rfind("--max-memory=", 0) == 0) {
+			valid = option_value(arg, 13, limits.max_bytes);
+		}
+		else if (arg.rfind("--", 0) == 0) {
+			std::cerr << "basic: unknown option '" << arg << "'" << std::endl;
+			print_usage();
+			return 2;
+		}
+		else script = arg;
+
+		if (!valid) {
+			std::cerr << "basic: invalid value in '" << arg << "'" << std::endl;
+			print_usage();
+			return 2;
+		}
+	}
+
+	if (!socket_path.empty()) return serve(socket_path, serve_workers, limits);
+	if (types) {
+		if (!script.empty()) return check_types(script);
+		std::cerr << "basic: --types needs a script" << std::endl;
+		return 2;
+	}
+	default_interpreter().limits = limits;
+	default_interpreter().stackless = stackless;
+
+	int status = 0;
+	if (profile || !trace_path.empty()) {
+		std::string error;
+		if (script.empty()) error = "--profile and --trace need a script";
+		else if (profile) Profiler::start(profile_hz, error);
+		if (!error.empty()) {
+			std::cerr << "basic: " << error << std::endl;
+			return 2;
+		}
+		if (!trace_path.empty()) Tracer::start();
+
+		status = run_file(script);
+		Tracer::stop();
+		if (!folded_path.empty()) std::ofstream(folded_path) << Profiler::folded();
+		if (!trace_path.empty()) std::ofstream(trace_path) << Tracer::trace_json();
+		if (profile_report) {
+			if (profile_path.empty()) std::cerr << Profiler::report();
+			else std::ofstream(profile_path) << Profiler::report();
+		}
+	}
+	else if (!script.empty()) status = run_file(script);
+	else status = run_repl();
+
+	if (summary) std::cerr << default_interpreter().summary.as_string();
+	if (stats) {
+		if (stats_path.empty()) std::cerr << ExecutionStats::json() << std::endl;
+		else std::ofstream(stats_path) << ExecutionStats::json() << std::endl;
+	}
+	return status;
+}
@@ -0,0 +1,94 @@
+#include "source_file.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+#ifdef _WIN32
+
+SourceFile::SourceFile(std::string path)
+    : path(path), data(nullptr), size(0), file_handle(INVALID_HANDLE_VALUE), mapping_handle(nullptr) {
+    file_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE) {
+        error = "could not open '" + path + "'";
+        return;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle, &file_size)) {
+        error = "could not read the size of '" + path + "'";
+        return;
+    }
+    size = static_cast<size_t>(file_size.QuadPart);
+    if (size == 0) return;
+
+    mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_handle == nullptr) {
+        error = "could not map '" + path + "'";
+        return;
+    }
+    data = static_cast<const char*>(MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+    if (data == nullptr) error = "could not map '" + path + "'";
+}
+
+SourceFile::~SourceFile() {
+    if (data != nullptr) UnmapViewOfFile(data);
+    if (mapping_handle != nullptr) CloseHandle(mapping_handle);
+    if (file_handle != INVALID_HANDLE_VALUE) CloseHandle(file_handle);
+}
+
+#else
+
+SourceFile::SourceFile(std::string path)
+    : path(path), data(nullptr), size(0) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "could not open '" + path + "': " + std::strerror(errno);
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        error = "could not read the size of '" + path + "': " + std::strerror(errno);
+        close(fd);
+        return;
+    }
+    size = static_cast<size_t>(st.st_size);
+
+    // mmap rejects zero-length mappings, so an empty file stays unmapped and
+    // text() is empty
+    if (size > 0) {
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            error = "could not map '" + path + "': " + std::strerror(errno);
+            size = 0;
+        }
+        else {
+            data = static_cast<const char*>(mapped);
+            madvise(mapped, size, MADV_SEQUENTIAL);
+        }
+    }
+    close(fd);
+}
+
+SourceFile::~SourceFile() {
+    if (data != nullptr) munmap(const_cast<char*>(data), size);
+}
+
+#endif
+
+bool SourceFile::is_open() const {
+    return error.empty();
+}
+
+std::string_view SourceFile::text() const {
+    if (data == nullptr) return std::string_view();
+    return std::string_view(data, size);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+// Read-only view of a script file on disk. The file is memory-mapped so the
+// lexer can walk it directly without first copying it into a std::string.
+class SourceFile
+{
+public:
+    SourceFile(std::string path);
+    ~SourceFile();
+
+    SourceFile(const SourceFile&) = delete;
+    SourceFile& operator=(const SourceFile&) = delete;
+
+    bool is_open() const;
+    std::string_view text() const;
+
+    std::string path, error;
+
+private:
+    const char* data;
+    size_t size;
+#ifdef _WIN32
+    void* file_handle;
+    void* mapping_handle;
+#endif
+};
@@ -0,0 +1,202 @@
+#include "stats.h"
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace {
+    const size_t node_kinds = static_cast<size_t>(ExecutionStats::NodeKind::count);
+    const size_t value_kinds = static_cast<size_t>(ExecutionStats::ValueKind::count);
+
+    const char* const node_kind_names[] = {
+        "NumberNode", "StringNode", "ListNode", "VarAccessNode", "VarAssignNode", "BinOpNode",
+        "UnaryOpNode", "IfNode", "ForNode", "WhileNode", "FuncDefNode", "CallNode", "CachedNode"
+    };
+    const char* const value_kind_names[] = { "Number", "String", "List" };
+
+    // Values below 16ns get a bucket each, above that every power of two is
+    // split into 8 buckets, so a bucket is never off by more than 12.5%
+    const size_t sub_buckets = 8;
+    const size_t linear_buckets = 16;
+    const size_t bucket_count = linear_buckets + (64 - 4) * sub_buckets;
+
+    size_t bucket_of(uint64_t value) {
+        if (value < linear_buckets) return static_cast<size_t>(value);
+        size_t exponent = 63;
+        while ((value >> exponent) == 0) exponent--;
+        size_t sub = static_cast<size_t>(value >> (exponent - 3)) & (sub_buckets - 1);
+        return linear_buckets + (exponent - 4) * sub_buckets + sub;
+    }
+
+    uint64_t bucket_floor(size_t bucket) {
+        if (bucket < linear_buckets) return bucket;
+        size_t exponent = 4 + (bucket - linear_buckets) / sub_buckets;
+        size_t sub = (bucket - linear_buckets) % sub_buckets;
+        return static_cast<uint64_t>(sub_buckets + sub) << (exponent - 3);
+    }
+
+    // Only the owning thread writes, so increments need no read-modify-write
+    void bump(std::atomic<uint64_t>& counter, uint64_t amount = 1) {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    struct NodeStats
+    {
+        std::atomic<uint64_t> count{ 0 }, total_ns{ 0 }, max_ns{ 0 };
+        std::atomic<uint64_t> buckets[bucket_count] = {};
+    };
+
+    struct ThreadStats
+    {
+        NodeStats nodes[node_kinds];
+        std::atomic<uint64_t> values[value_kinds] = {};
+    };
+
+    // Blocks outlive their threads so counts from exited workers still add
+    // up. Values are created during static initialization (Number::null_ and
+    // friends) and by pool threads up to process exit, so the registry is
+    // built on first use and never destroyed.
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadStats>> threads;
+    };
+
+    Registry& registry() {
+        static Registry* registry = new Registry();
+        return *registry;
+    }
+
+    ThreadStats& thread_stats() {
+        thread_local ThreadStats* stats = nullptr;
+        if (stats == nullptr) {
+            std::lock_guard<std::mutex> lock(registry().mutex);
+            registry().threads.push_back(std::unique_ptr<ThreadStats>(new ThreadStats()));
+            stats = registry().threads.back().get();
+        }
+        return *stats;
+    }
+
+    // Innermost ValueCountScope of the current thread
+    thread_local ValueCountScope* current_value_scope = nullptr;
+
+    uint64_t percentile(const std::vector<uint64_t>& buckets, uint64_t count, double fraction) {
+        if (count == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(fraction * (count - 1)) + 1, seen = 0;
+        for (size_t b = 0; b < bucket_count; b++) {
+            seen += buckets[b];
+            if (seen >= rank) return bucket_floor(b);
+        }
+        return bucket_floor(bucket_count - 1);
+    }
+}
+
+void ExecutionStats::record_visit(NodeKind kind, uint64_t nanoseconds) {
+    NodeStats& stats = thread_stats().nodes[static_cast<size_t>(kind)];
+    bump(stats.count);
+    bump(stats.total_ns, nanoseconds);
+    if (nanoseconds > stats.max_ns.load(std::memory_order_relaxed)) stats.max_ns.store(nanoseconds, std::memory_order_relaxed);
+    bump(stats.buckets[bucket_of(nanoseconds)]);
+}
+
+void ExecutionStats::record_value(ValueKind kind) {
+    bump(thread_stats().values[static_cast<size_t>(kind)]);
+    if (current_value_scope != nullptr) current_value_scope->count++;
+}
+
+std::string ExecutionStats::json() {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    std::vector<std::unique_ptr<ThreadStats>>& threads = registry().threads;
+    std::ostringstream out;
+
+    out << "{\"visits\":{";
+    for (size_t k = 0; k < node_kinds; k++) {
+        uint64_t count = 0, total_ns = 0, max_ns = 0;
+        std::vector<uint64_t> buckets(bucket_count, 0);
+        for (auto& thread : threads) {
+            NodeStats& stats = thread->nodes[k];
+            count += stats.count.load(std::memory_order_relaxed);
+            total_ns += stats.total_ns.load(std::memory_order_relaxed);
+            max_ns = std::max(max_ns, stats.max_ns.load(std::memory_order_relaxed));
+            for (size_t b = 0; b < bucket_count; b++) buckets[b] += stats.buckets[b].load(std::memory_order_relaxed);
+        }
+
+        out << (k == 0 ? "" : ",") << "\"" << node_kind_names[k] << "\":{\"count\":" << count
+            << ",\"total_ns\":" << total_ns
+            << ",\"mean_ns\":" << (count == 0 ? 0 : total_ns / count)
+            << ",\"p50_ns\":" << percentile(buckets, count, 0.50)
+            << ",\"p90_ns\":" << percentile(buckets, count, 0.90)
+            << ",\"p99_ns\":" << percentile(buckets, count, 0.99)
+            << ",\"max_ns\":" << max_ns << "}";
+    }
+
+    out << "},\"values_created\":{";
+    for (size_t k = 0; k < value_kinds; k++) {
+        uint64_t count = 0;
+        for (auto& thread : threads) count += thread->values[k].load(std::memory_order_relaxed);
+        out << (k == 0 ? "" : ",") << "\"" << value_kind_names[k] << "\":" << count;
+    }
+    out << "},\"threads\":" << threads.size() << "}";
+    return out.str();
+}
+
+uint64_t ExecutionStats::values_created() {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    uint64_t count = 0;
+    for (auto& thread : registry().threads) {
+        for (size_t k = 0; k < value_kinds; k++) count += thread->values[k].load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+ValueCountScope::ValueCountScope(std::atomic<uint64_t>& counter)
+    : counter(counter), outer(current_value_scope) {
+    current_value_scope = this;
+}
+
+ValueCountScope::~ValueCountScope() {
+    counter.fetch_add(count, std::memory_order_relaxed);
+    current_value_scope = outer;
+}
+
+long peak_rss_kb() {
+#ifdef _WIN32
+    return 0;
+#else
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+void RunSummary::set_parse_phases(const RunSummary& parsed) {
+    lex_wall_ms = parsed.lex_wall_ms;
+    lex_cpu_ms = parsed.lex_cpu_ms;
+    parse_wall_ms = parsed.parse_wall_ms;
+    parse_cpu_ms = parsed.parse_cpu_ms;
+    tokens = parsed.tokens;
+    ast_nodes = parsed.ast_nodes;
+}
+
+std::string RunSummary::as_string() const {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "phase      wall ms      cpu ms\n";
+    out << "lex    " << std::setw(12) << lex_wall_ms << std::setw(12) << lex_cpu_ms << "\n";
+    out << "parse  " << std::setw(12) << parse_wall_ms << std::setw(12) << parse_cpu_ms << "\n";
+    out << "run    " << std::setw(12) << run_wall_ms << std::setw(12) << run_cpu_ms << "\n";
+    out << "tokens=" << tokens << " ast_nodes=" << ast_nodes << " operations=" << operations << "\n";
+    out << "values_created=" << values_created << " allocated_bytes=" << allocated_bytes << " frames=" << frames << "\n";
+    out << "peak_rss_kb=" << peak_rss_kb << "\n";
+    return out.str();
+}
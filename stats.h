@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <string>
+
+// Execution statistics, always on: how often each node type is visited, a
+// log-linear (HDR-style) histogram of the time each visit takes including
+// its children, and how many Number, String and List values are created.
+// Every thread counts into its own block, only ever written by that thread,
+// so recording is a relaxed load and store with no shared cache lines.
+// Blocks are merged when a report is asked for.
+class ExecutionStats
+{
+public:
+    enum class NodeKind {
+        NumberNode, StringNode, ListNode, VarAccessNode, VarAssignNode, BinOpNode,
+        UnaryOpNode, IfNode, ForNode, WhileNode, FuncDefNode, CallNode, CachedNode, count
+    };
+    enum class ValueKind { Number, String, List, count };
+
+    static void record_visit(NodeKind kind, uint64_t nanoseconds);
+    static void record_value(ValueKind kind);
+
+    // Counters and histograms of every thread so far as a JSON object
+    static std::string json();
+    static uint64_t values_created();
+};
+
+// Attributes the values created on the current thread to counter for as long
+// as it exists, so that instances running side by side each count their own.
+// Scopes nest, and each one adds what it saw to its counter when it ends.
+class ValueCountScope
+{
+public:
+    ValueCountScope(std::atomic<uint64_t>& counter);
+    ~ValueCountScope();
+
+    ValueCountScope(const ValueCountScope&) = delete;
+    ValueCountScope& operator=(const ValueCountScope&) = delete;
+
+private:
+    friend class ExecutionStats;
+
+    std::atomic<uint64_t>& counter;
+    uint64_t count = 0;
+    ValueCountScope* outer;
+};
+
+// Where the time and memory of one run went (basic --summary). CPU time is
+// the whole process's, so work handed to the thread pool counts as well.
+struct RunSummary
+{
+    double lex_wall_ms = 0, lex_cpu_ms = 0;
+    double parse_wall_ms = 0, parse_cpu_ms = 0;
+    double run_wall_ms = 0, run_cpu_ms = 0;
+    size_t tokens = 0;
+    size_t ast_nodes = 0;
+    uint64_t operations = 0;      // nodes evaluated
+    uint64_t values_created = 0;  // Number, String and List values
+    uint64_t allocated_bytes = 0; // strings, lists and frames, as charged against ExecutionLimits::max_bytes
+    size_t frames = 0;            // call and PARFOR frames created
+    long peak_rss_kb = 0;         // of the process so far, 0 where unknown
+
+    // Copies the lex and parse phases of a summary filled in by parse_program
+    void set_parse_phases(const RunSummary& parsed);
+    std::string as_string() const;
+};
+
+// Wall and CPU time since construction
+class PhaseTimer
+{
+public:
+    PhaseTimer()
+        : wall_started(std::chrono::steady_clock::now()), cpu_started(std::clock()) {}
+
+    double wall_ms() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall_started).count();
+    }
+    double cpu_ms() const {
+        return 1000.0 * (std::clock() - cpu_started) / CLOCKS_PER_SEC;
+    }
+
+private:
+    std::chrono::steady_clock::time_point wall_started;
+    std::clock_t cpu_started;
+};
+
+long peak_rss_kb();
+
+// Times one visit from construction to destruction
+class VisitTimer
+{
+public:
+    VisitTimer(ExecutionStats::NodeKind kind)
+        : kind(kind), started(std::chrono::steady_clock::now()) {}
+    ~VisitTimer() {
+        ExecutionStats::record_visit(kind, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count());
+    }
+
+    VisitTimer(const VisitTimer&) = delete;
+    VisitTimer& operator=(const VisitTimer&) = delete;
+
+private:
+    ExecutionStats::NodeKind kind;
+    std::chrono::steady_clock::time_point started;
+};
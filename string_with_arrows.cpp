@@ -1,7 +1,7 @@
 #include "string_with_arrows.h"
 #include <algorithm>
 
-std::string string_with_arrows(const std::string& text, const Position& pos_start, const Position& pos_end) {
+std::string string_with_arrows(std::string_view text, const Position& pos_start, const Position& pos_end) {
     std::string result = "";
 
     // Calculate indices
@@ -13,7 +13,7 @@ std::string string_with_arrows(const std::string& text, const Position& pos_star
     int line_count = pos_end.ln - pos_start.ln + 1;
     for (int i = 0; i < line_count; i++) {
         // Calculate line columns
-        std::string line = text.substr(idx_start, idx_end - idx_start);
+        std::string line = std::string(text.substr(idx_start, idx_end - idx_start));
         int col_start = (i == 0) ? pos_start.col : 0;
         int col_end = (i == line_count - 1) ? pos_end.col : line.length() - 1;
 
@@ -1,8 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "basic.h"
 
-std::string string_with_arrows(const std::string& text, const Position& pos_start, const Position& pos_end);
+std::string string_with_arrows(std::string_view text, const Position& pos_start, const Position& pos_end);
 
 
@@ -0,0 +1,17 @@
+PRINT(1 + 2 * 3)
+PRINT((1 + 2) * 3)
+PRINT(2 ^ 10)
+PRINT(7 / 2)
+PRINT(-3 - -4)
+PRINT(0.1 + 0.2)
+PRINT(10 - 0)
+PRINT(1 == 1)
+PRINT(2 < 1 OR 3 >= 3)
+PRINT(NOT 0 AND 1)
+PRINT("ab" + "cd")
+PRINT("ab" * 3)
+VAR x = 5
+PRINT(x * x - x)
+VAR z = -0
+PRINT(z + 0)
+PRINT(z * 1)
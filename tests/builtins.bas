@@ -0,0 +1,13 @@
+FUN sub(a, b) -> a - b
+FUN sq(x) -> x * x
+PRINT(REDUCE([1, 2, 3, 4], sub, 0))
+PRINT(REDUCE([], sub, 7))
+PRINT(PARALLEL_MAP([1, 2, 3, 4], sq))
+PRINT(AWAIT(SPAWN(sq, 9)))
+VAR ch = CHANNEL(4)
+SEND(ch, "a")
+SEND(ch, "b")
+CLOSE(ch)
+PRINT(RECV(ch))
+PRINT(RECV(ch))
+PRINT(IS_FUN(sq) AND IS_FUN(PRINT))
@@ -0,0 +1,99 @@
+// basic_check: runs each regression script once with the recursive
+// interpreter and once with the stackless Evaluator (basic --stackless) and
+// checks that both give the program output and error, traceback included,
+// recorded in the .out file next to the script.
+//
+// usage: basic_check script.bas...
+// Exits with 1 if any script differs in either mode.
+
+#include "../basic.h"
+#include "../source_file.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// The interpreter traces every step to std::cout; only what the program
+// itself writes goes through the instance's output sink
+class NullBuffer : public std::streambuf
+{
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+// Program output followed by the error that ended the program, if any
+static std::string run_script(const std::string& name, std::string_view source, bool stackless) {
+    std::string output;
+    InterpreterInstance instance;
+    instance.stackless = stackless;
+    instance.output.set_writer([&output](std::string_view data) { output.append(data); });
+
+    // The error points into the source and the instance's frames, so it is
+    // formatted before either goes away
+    std::pair<std::shared_ptr<Node>, Error> result = instance.run(name, source);
+    instance.output.flush();
+    if (result.second.is_error() != "None") output += result.second.as_string();
+    return output;
+}
+
+// Scripts and .out files may be checked out with either line ending
+static std::string without_carriage_returns(std::string text) {
+    text.erase(std::remove(text.begin(), text.end(), '\r'), text.end());
+    return text;
+}
+
+static std::string file_name(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+// Returns an empty string if the script passes in both modes
+static std::string check_script(const std::string& path) {
+    SourceFile source(path);
+    if (!source.is_open()) return source.error;
+
+    std::string expected_path = path.substr(0, path.rfind('.')) + ".out";
+    std::ifstream expected_file(expected_path, std::ios::binary);
+    if (!expected_file) return "cannot open " + expected_path;
+    std::ostringstream expected_text;
+    expected_text << expected_file.rdbuf();
+    std::string expected = without_carriage_returns(expected_text.str());
+
+    // Named without the directory, so tracebacks read the same wherever the
+    // checker is run from
+    std::string name = file_name(path);
+    std::ostringstream failures;
+    for (bool stackless : { false, true }) {
+        std::string output = without_carriage_returns(run_script(name, source.text(), stackless));
+        if (output == expected) continue;
+        failures << (stackless ? "stackless" : "recursive") << " output differs, got\n" << output << "\n";
+    }
+    return failures.str();
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> scripts(argv + 1, argv + argc);
+    if (scripts.empty()) {
+        std::cerr << "usage: basic_check script.bas..." << std::endl;
+        return 2;
+    }
+
+    NullBuffer null_buffer;
+    std::streambuf* console = std::cout.rdbuf(&null_buffer);
+    size_t failed = 0;
+    for (const std::string& path : scripts) {
+        std::string failure = check_script(path);
+        if (failure.empty()) std::cerr << "ok      " << path << std::endl;
+        else {
+            std::cerr << "FAILED  " << path << "\n" << failure << std::endl;
+            failed++;
+        }
+    }
+    std::cout.rdbuf(console);
+
+    std::cerr << scripts.size() - failed << " of " << scripts.size() << " scripts passed" << std::endl;
+    return failed == 0 ? 0 : 1;
+}
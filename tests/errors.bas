@@ -0,0 +1,6 @@
+FUN inner(x) -> x / 0
+FUN middle(x) -> inner(x) + 1
+FUN outer(x) -> middle(x) * 2
+PRINT("before")
+outer(3)
+PRINT("never printed")
@@ -0,0 +1,15 @@
+FUN add(a, b) -> a + b
+PRINT(add(2, 3))
+FUN inc(n) -> n + 1
+VAR twice = FUN (f, x) -> f(f(x))
+PRINT(twice(inc, 5))
+FUN even(n) -> n == 0 OR (n > 1 AND even(n - 2))
+PRINT(even(100))
+PRINT(even(77))
+VAR calls = []
+FUN fib(n) -> (APPEND(calls, n) OR 1) AND (n < 2 OR (fib(n - 1) AND fib(n - 2)))
+fib(6)
+PRINT(calls)
+FUN show() -> y
+FUN with_y(y) -> show()
+PRINT(with_y(42))
@@ -0,0 +1,12 @@
+VAR l = [1, 2, 3]
+PRINT(l + 4)
+PRINT(l * [5, 6])
+PRINT(l / 1)
+PRINT(l - 0)
+APPEND(l, 10)
+PRINT(l)
+PRINT(POP(l, 0))
+EXTEND(l, [7, 8])
+PRINT(l)
+PRINT(IS_LIST(l) AND IS_NUM(l / 0) AND NOT IS_STR(l))
+PRINT([[1, 2], [], "s"])
@@ -0,0 +1,12 @@
+PRINT(FOR i = 0 TO 5 THEN i * i)
+PRINT(FOR i = 10 TO 0 STEP -2 THEN i)
+PRINT(FOR i = 0 TO 1 STEP 0.25 THEN i)
+VAR n = 0
+WHILE n < 5 THEN VAR n = n + 1
+PRINT(n)
+VAR total = 0
+FOR i = 1 TO 101 THEN VAR total = total + i
+PRINT(total)
+VAR k = 3
+PRINT(FOR i = 0 TO 4 THEN k * 10 + i)
+PRINT(PARFOR i = 0 TO 8 THEN i * 3)
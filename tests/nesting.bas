@@ -0,0 +1 @@
+PRINT(----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------1)
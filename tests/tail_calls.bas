@@ -0,0 +1,3 @@
+FUN down(n) -> down(n - 1 + 0 * (1 / n))
+PRINT("counting down")
+down(20000)
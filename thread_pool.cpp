@@ -0,0 +1,251 @@
+#include "thread_pool.h"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+    // Which pool the current thread works for and the index of its queue there
+    thread_local ThreadPool* current_pool = nullptr;
+    thread_local size_t current_index = 0;
+
+    const size_t no_queue = static_cast<size_t>(-1);
+}
+
+ThreadPool::ThreadPool(size_t worker_count)
+    : idle(0), blocked(0), queued(0), next_queue(0), stopping(false) {
+    if (worker_count == 0) worker_count = std::thread::hardware_concurrency();
+    if (worker_count == 0) worker_count = 1;
+
+    for (size_t i = 0; i < worker_count; i++) queues.push_back(std::make_unique<WorkQueue>());
+    for (size_t i = 0; i < worker_count; i++) workers.emplace_back(&ThreadPool::worker_loop, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    stop();
+}
+
+void ThreadPool::stop() {
+    std::unique_lock<std::mutex> lock(wake_mutex);
+    if (stopping) return;
+    stopping = true;
+    wake.notify_all();
+
+    // No new spares start once stopping is set. Every thread either runs out
+    // of work and exits or ends up blocked, possibly in a task it is still
+    // running now.
+    std::vector<std::thread*> threads;
+    for (std::thread& worker : workers) threads.push_back(&worker);
+    for (std::thread& spare : spares) threads.push_back(&spare);
+    auto listed = [](const std::vector<std::thread::id>& ids, std::thread::id id) {
+        return std::find(ids.begin(), ids.end(), id) != ids.end();
+    };
+    wake.wait(lock, [&] {
+        return std::all_of(threads.begin(), threads.end(), [&](std::thread* thread) {
+            return listed(exited_threads, thread->get_id()) || listed(blocked_threads, thread->get_id());
+        });
+    });
+    std::vector<std::thread::id> exited = exited_threads;
+    lock.unlock();
+
+    for (std::thread* thread : threads) {
+        if (listed(exited, thread->get_id())) thread->join();
+        else thread->detach();
+    }
+}
+
+size_t ThreadPool::size() const {
+    return workers.size();
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    // Workers keep what they spawn local, everyone else spreads it round robin
+    bool own_queue = current_pool == this && current_index != no_queue;
+    size_t index = own_queue ? current_index : next_queue++ % queues.size();
+    // Counted before it can be taken, or take_task could count it off first
+    // and wrap queued round
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex);
+        queued++;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    wake.notify_one();
+}
+
+bool ThreadPool::take_task(std::function<void()>& task) {
+    size_t count = queues.size();
+    bool own_queue = current_pool == this && current_index != no_queue;
+    size_t first = own_queue ? current_index : next_queue.load() % count;
+
+    // Own work newest first, stolen work oldest first
+    for (size_t n = 0; n < count; n++) {
+        size_t index = (first + n) % count;
+        WorkQueue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) continue;
+
+        if (n == 0 && own_queue) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        queued--;
+        return true;
+    }
+    return false;
+}
+
+bool ThreadPool::run_one() {
+    std::function<void()> task;
+    if (!take_task(task)) return false;
+    task();
+    return true;
+}
+
+void ThreadPool::worker_loop(size_t index) {
+    current_pool = this;
+    current_index = index;
+
+    while (true) {
+        if (run_one()) continue;
+
+        std::unique_lock<std::mutex> lock(wake_mutex);
+        idle++;
+        wake.wait(lock, [this] { return stopping || queued > 0; });
+        idle--;
+        if (stopping) {
+            lock.unlock();
+            thread_exiting();
+            return;
+        }
+    }
+}
+
+// Tells stop() the thread will not touch the pool again
+void ThreadPool::thread_exiting() {
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex);
+        exited_threads.push_back(std::this_thread::get_id());
+    }
+    wake.notify_all();
+}
+
+// Like worker_loop, but for a thread that only stands in for a blocked one.
+// It leaves as soon as it runs out of work while fewer threads are blocked
+// than spares are running.
+void ThreadPool::spare_loop() {
+    current_pool = this;
+    current_index = no_queue;
+
+    while (true) {
+        if (run_one()) continue;
+
+        std::unique_lock<std::mutex> lock(wake_mutex);
+        if (stopping || surplus_spare()) {
+            retired.push_back(std::this_thread::get_id());
+            lock.unlock();
+            thread_exiting();
+            return;
+        }
+        idle++;
+        wake.wait(lock, [this] { return stopping || queued > 0 || surplus_spare(); });
+        idle--;
+    }
+}
+
+// Expects wake_mutex to be held
+bool ThreadPool::surplus_spare() const {
+    return spares.size() - retired.size() > blocked;
+}
+
+// Called by a pool thread about to wait for something only another task can
+// provide. If every other thread is busy too, the queued tasks would never
+// run, so a spare worker takes over the waiting thread's share of the pool.
+void ThreadPool::prepare_to_block() {
+    if (current_pool != this) return;
+
+    std::lock_guard<std::mutex> lock(wake_mutex);
+    blocked++;
+    blocked_threads.push_back(std::this_thread::get_id());
+    if (stopping) {
+        wake.notify_all();
+        return;
+    }
+
+    // Retired spares are past their last use of the pool and only need joining
+    for (std::thread::id id : retired) {
+        auto spare = std::find_if(spares.begin(), spares.end(), [id](const std::thread& t) { return t.get_id() == id; });
+        spare->join();
+        spares.erase(spare);
+        // Its id may be given to a thread started later
+        exited_threads.erase(std::find(exited_threads.begin(), exited_threads.end(), id));
+    }
+    retired.clear();
+
+    if (idle == 0) spares.emplace_back(&ThreadPool::spare_loop, this);
+}
+
+// Called by the same thread once the wait announced by prepare_to_block() is
+// over. Idle spares are woken so the surplus ones can retire.
+void ThreadPool::finish_blocking() {
+    if (current_pool != this) return;
+
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex);
+        blocked--;
+        blocked_threads.erase(std::find(blocked_threads.begin(), blocked_threads.end(), std::this_thread::get_id()));
+        if (!surplus_spare()) return;
+    }
+    wake.notify_all();
+}
+
+// Calls body(begin, end) over [0, count) in chunks of at most grain
+// iterations and returns once all of them are done. The calling thread runs
+// chunks as well while it waits.
+void ThreadPool::parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+    if (count == 0) return;
+    if (grain == 0) grain = 1;
+
+    struct Batch
+    {
+        std::atomic<size_t> remaining;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->remaining = (count + grain - 1) / grain;
+
+    for (size_t begin = 0; begin < count; begin += grain) {
+        size_t end = std::min(count, begin + grain);
+        submit([batch, &body, begin, end] {
+            body(begin, end);
+            if (--batch->remaining == 0) {
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                batch->done.notify_all();
+            }
+        });
+    }
+
+    while (batch->remaining > 0) {
+        if (run_one()) continue;
+
+        // Nothing left to help with, the last chunks are running elsewhere.
+        // Wake up now and then in case one of them spawns work we could take.
+        std::unique_lock<std::mutex> lock(batch->mutex);
+        batch->done.wait_for(lock, std::chrono::milliseconds(1), [&batch] { return batch->remaining == 0; });
+    }
+}
+
+ThreadPool& shared_thread_pool() {
+    // Never freed, so that threads stop() detaches can still finish blocking
+    static ThreadPool* pool = new ThreadPool();
+    static struct Stopper
+    {
+        ~Stopper() { pool->stop(); }
+    } stopper;
+    return *pool;
+}
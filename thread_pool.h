@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing pool behind the parallel constructs (PARFOR). Every worker
+// owns a deque of tasks: it takes new work from the back of its own deque and,
+// once that runs dry, steals from the front of the others'. A thread waiting
+// for its tasks to finish runs pending tasks instead of blocking, so parallel
+// loops nested inside parallel loops cannot starve the pool. Tasks that have
+// to block on something else (a channel, a future) announce it with
+// prepare_to_block() and finish_blocking(). A spare worker is started if
+// nobody is left idle to run the queued work, and it retires again once there
+// are more spares than blocked threads, so the pool only grows while its
+// threads are actually waiting.
+class ThreadPool
+{
+public:
+    ThreadPool(size_t worker_count = 0); // 0 means one worker per hardware thread
+    ~ThreadPool(); // calls stop()
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(std::function<void()> task);
+    bool run_one();
+    void prepare_to_block();
+    void finish_blocking();
+    void parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body);
+    size_t size() const;
+    // Lets the threads go once they run out of work and joins them, except
+    // those left blocked between prepare_to_block() and finish_blocking():
+    // what they wait for may never come, so they are detached and the pool
+    // has to outlive them.
+    void stop();
+
+private:
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void worker_loop(size_t index);
+    void spare_loop();
+    void thread_exiting();
+    bool surplus_spare() const;
+    bool take_task(std::function<void()>& task);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+    std::vector<std::thread> spares; // have no queue of their own, only steal
+    std::vector<std::thread::id> retired; // spares that have left, joined on the next block
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    size_t idle;
+    size_t blocked;
+    std::vector<std::thread::id> blocked_threads; // ones that are blocked right now
+    std::vector<std::thread::id> exited_threads;  // ones past their last use of the pool
+    std::atomic<size_t> queued;
+    std::atomic<size_t> next_queue;
+    bool stopping;
+};
+
+// Pool shared by every interpreter instance in the process, started on first
+// use and stopped at exit
+ThreadPool& shared_thread_pool();
@@ -0,0 +1,115 @@
+#include "tracer.h"
+#include "basic.h"
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+std::atomic<bool> Tracer::active(false);
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const size_t max_events = 1000000; // per run, later calls are counted as dropped
+
+    struct Event
+    {
+        std::string name, call_site;
+        double start_us, duration_us;
+    };
+
+    struct ThreadTrace
+    {
+        size_t tid;
+        std::vector<Event> events;
+    };
+
+    // Buffers outlive their threads so that pool workers which exit before
+    // the trace is written still show up in it
+    std::mutex registry_mutex;
+    std::vector<std::shared_ptr<ThreadTrace>> registry;
+    Clock::time_point trace_start;
+    std::atomic<size_t> event_count(0);
+
+    ThreadTrace& thread_trace() {
+        thread_local std::shared_ptr<ThreadTrace> trace;
+        if (trace == nullptr) {
+            trace = std::make_shared<ThreadTrace>();
+            std::lock_guard<std::mutex> lock(registry_mutex);
+            trace->tid = registry.size() + 1;
+            registry.push_back(trace);
+        }
+        return *trace;
+    }
+
+    double since_start_us(Clock::time_point time) {
+        return std::chrono::duration<double, std::micro>(time - trace_start).count();
+    }
+
+    std::string json_string(const std::string& text) {
+        std::ostringstream out;
+        out << '"';
+        for (char c : text) {
+            if (c == '"' || c == '\\') out << '\\' << c;
+            else if (c == '\n') out << "\\n";
+            else if (static_cast<unsigned char>(c) < 0x20) out << "\\u00" << "0123456789abcdef"[c >> 4] << "0123456789abcdef"[c & 15];
+            else out << c;
+        }
+        out << '"';
+        return out.str();
+    }
+}
+
+void TraceScope::enter(const std::string& name, const Position& call_site) {
+    entered = true;
+    this->name = &name;
+    this->call_site = &call_site;
+    started = Clock::now();
+}
+
+void TraceScope::leave() {
+    Clock::time_point finished = Clock::now();
+    if (!Tracer::is_active() || event_count.fetch_add(1, std::memory_order_relaxed) >= max_events) return;
+
+    Event event;
+    event.name = *name;
+    event.call_site = call_site->fn + ":" + std::to_string(call_site->ln + 1);
+    event.start_us = since_start_us(started);
+    event.duration_us = std::chrono::duration<double, std::micro>(finished - started).count();
+    thread_trace().events.push_back(event);
+}
+
+void Tracer::start() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (auto& trace : registry) trace->events.clear();
+    event_count = 0;
+    trace_start = Clock::now();
+    active = true;
+}
+
+void Tracer::stop() {
+    active = false;
+}
+
+// Complete ("X") events, one per call, with the call site as an argument
+std::string Tracer::trace_json() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (auto& trace : registry) {
+        out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << trace->tid
+            << ",\"args\":{\"name\":\"thread " << trace->tid << "\"}}";
+        first = false;
+        for (const Event& event : trace->events) {
+            out << ",\n{\"name\":" << json_string(event.name) << ",\"cat\":\"basic\",\"ph\":\"X\",\"pid\":1,\"tid\":" << trace->tid
+                << ",\"ts\":" << event.start_us << ",\"dur\":" << event.duration_us
+                << ",\"args\":{\"call_site\":" << json_string(event.call_site) << "}}";
+        }
+    }
+    size_t dropped = event_count > max_events ? event_count - max_events : 0;
+    out << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":" << dropped << "}}\n";
+    return out.str();
+}
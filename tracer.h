@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+class Position;
+
+// Records every BASIC function call as a Chrome trace_event duration event
+// (basic --trace=FILE). The JSON loads into chrome://tracing, Perfetto or
+// speedscope. Each thread appends to a buffer of its own; timestamps come
+// from steady_clock relative to start().
+class Tracer
+{
+public:
+    static void start();
+    static void stop();
+    static std::string trace_json();
+
+    static bool is_active() { return active.load(std::memory_order_relaxed); }
+
+    static std::atomic<bool> active;
+};
+
+// Times one call from construction to destruction. Does nothing unless the
+// tracer runs.
+class TraceScope
+{
+public:
+    TraceScope(const std::string& name, const Position& call_site) {
+        if (Tracer::is_active()) enter(name, call_site);
+    }
+    ~TraceScope() {
+        if (entered) leave();
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    void enter(const std::string& name, const Position& call_site);
+    void leave();
+
+    bool entered = false;
+    const std::string* name = nullptr;
+    const Position* call_site = nullptr;
+    std::chrono::steady_clock::time_point started;
+};